@@ -1,34 +1,133 @@
 # opentxs bash-completion (Open Transactions Project - opentransactions.org)
 # autocompletion for opentxs commands (Open Transactions command-line client)
+#
+# No client is ever started. Command names, options and option values come
+# from the completion index generated when opentxs is built, which is read
+# once per shell. Nym, account, server and unit IDs come from the cache the
+# CLI keeps in its data folder whenever the wallet changes.
+#
+# OPENTXS_COMPLETION_INDEX overrides the location of the index, which is
+# otherwise looked up next to the opentxs executable. Without an installed
+# index (a cross build does not generate one) it is taken from
+# "opentxs --completion-index", which needs no client either.
+# OPENTXS_DATA_FOLDER overrides the data folder (~/.ot).
+
+declare -A _opentxs_options _opentxs_switches _opentxs_values
+_opentxs_commands=
+_opentxs_global=
+_opentxs_flags=
+_opentxs_loaded=
+
+_opentxs_load_index()
+{
+    local index data kind command option values
+
+    index=${OPENTXS_COMPLETION_INDEX}
+    if [[ -z ${index} ]] ; then
+        index=$(type -P opentxs)
+        index=${index%/bin/*}/share/opentxs/opentxs.completion
+    fi
+    if [[ -r ${index} ]] ; then
+        data=$(< "${index}")
+    else
+        type -P opentxs > /dev/null || return 1
+        data=$(opentxs --completion-index 2> /dev/null) || return 1
+    fi
+
+    while read -r kind command option values ; do
+        case ${kind} in
+            command)
+                _opentxs_commands+=" ${command}"
+                _opentxs_options[${command}]="${option} ${values}"
+                ;;
+            flags)
+                _opentxs_flags="${command} ${option} ${values}"
+                ;;
+            switches)
+                _opentxs_switches[${command}]="${option} ${values}"
+                ;;
+            global)
+                _opentxs_global="${command} ${option} ${values}"
+                ;;
+            values)
+                _opentxs_values[${command} ${option}]=${values}
+                ;;
+        esac
+    done <<< "${data}"
+
+    _opentxs_loaded=1
+}
+
+# the IDs of one kind (nym, account, server or unit) from the ID cache
+_opentxs_ids()
+{
+    local ids=${OPENTXS_DATA_FOLDER:-${HOME}/.ot}/completion-ids
+    [[ -r ${ids} ]] || return
+    awk -F '\t' -v kind="$1" '$1 == kind { print $2 }' "${ids}"
+}
 
 _opentxs_complete()
 {
-    local cur_word prev_word type_list
+    local cur_word prev_word command option word i kind
 
     # COMP_WORDS is an array of words in the current command line.
     # COMP_CWORD is the index of the current word (the one the cursor is
-    # in). So COMP_WORDS[COMP_CWORD] is the current word; we also record
-    # the previous word here, although this specific script doesn't
-    # use it yet.
+    # in). So COMP_WORDS[COMP_CWORD] is the current word.
     cur_word="${COMP_WORDS[COMP_CWORD]}"
     prev_word="${COMP_WORDS[COMP_CWORD-1]}"
+    COMPREPLY=()
 
-    # Ask opentxs to generate a list of types it supports
-    type_list='acceptall acceptinbox acceptinvoices acceptmoney acceptpayments acceptreceipts accepttransfers addasset addserver addsignature balance buyvoucher cancel changepw checknym clearexpired clearrecords 
-confirm credentials decode decrypt delmail deloutmail deposit discard editacct editasset editnym editserver encode encrypt exchange expired exportcash exportnym getboxreceipt getcontract getmarkets getmyoffers 
-getoffers help importcash importnym inbox issueasset killoffer killplan mail newacct newasset newbasket newcred newkey newnym newoffer newserver outbox outmail outpayment pass_decrypt pass_encrypt paydividend payinvoice 
-payments propose records refresh refreshacct refreshnym register revokecred sendcash sendcheque sendinvoice sendmsg sendvoucher showaccounts showacct showassets showbasket showcred showincoming showmarkets showmint 
-showmyoffers shownym shownyms showoffers showoutgoing showpayment showpurse showservers sign stat transfer trigger verifyreceipt verifysig withdraw writecheque writeinvoice'
-
-    # COMPREPLY is the array of possible completions, generated with
-    # the compgen builtin.
-    if [[ ${prev_word} == 'opentxs' ]] ; then
-    	COMPREPLY=( $(compgen -W "${type_list}" -- ${cur_word}) )
-    else
-        COMPREPLY=()
+    [[ -n ${_opentxs_loaded} ]] || _opentxs_load_index || return 0
+
+    # the command is the first word that is neither an option nor the value
+    # of one
+    for (( i = 1; i < COMP_CWORD; i++ )) ; do
+        word=${COMP_WORDS[i]}
+        option=${COMP_WORDS[i-1]#--}
+        if [[ ${word} != -* && ( ${COMP_WORDS[i-1]} != --* ||
+            " ${_opentxs_flags} " == *" ${option} "* ) ]] ; then
+            command=${word}
+            break
+        fi
+    done
+
+    # the value of an option
+    if [[ ${prev_word} == --* && " ${_opentxs_flags} " != *" ${prev_word#--} "* &&
+        " ${_opentxs_switches[${command}]} " != *" ${prev_word#--} "* ]] ; then
+        option=${prev_word#--}
+        if [[ -n ${_opentxs_values[${command} ${option}]} ]] ; then
+            COMPREPLY=( $(compgen -W "${_opentxs_values[${command} ${option}]}" -- "${cur_word}") )
+            return 0
+        fi
+        if [[ -n ${_opentxs_values[* ${option}]} ]] ; then
+            COMPREPLY=( $(compgen -W "${_opentxs_values[* ${option}]}" -- "${cur_word}") )
+            return 0
+        fi
+
+        case ${option} in
+            mynym|hisnym) kind=nym ;;
+            myacct|hisacct|account) kind=account ;;
+            server) kind=server ;;
+            mypurse|hispurse) kind=unit ;;
+        esac
+        if [[ -n ${kind} ]] ; then
+            COMPREPLY=( $(compgen -W "$(_opentxs_ids ${kind})" -- "${cur_word}") )
+            return 0
+        fi
+
+        # anything else is free text or a file name
+        return 0
+    fi
+
+    if [[ ${cur_word} == -* ]] ; then
+        local options="${_opentxs_flags} ${_opentxs_global}"
+        [[ -n ${command} ]] && options+=" ${_opentxs_options[${command}]}"
+        COMPREPLY=( $(compgen -P '--' -W "${options}" -- "${cur_word#--}") )
+    elif [[ -z ${command} ]] ; then
+        COMPREPLY=( $(compgen -W "${_opentxs_commands}" -- "${cur_word}") )
     fi
     return 0
 }
 
-# Register _pss_complete to provide completion for the following commands
-complete -F _opentxs_complete opentxs
+# Register _opentxs_complete to provide completion for the following commands
+complete -o default -F _opentxs_complete opentxs
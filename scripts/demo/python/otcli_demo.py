@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+#
+# Runs opentxs commands in-process through libopentxs-cli, so the client
+# starts and loads the wallet only once for any number of commands.
+#
+# Set OTCLI_LIBRARY if libopentxs-cli.so is not on the library path.
+#
+import ctypes
+import os
+import sys
+
+lib = ctypes.CDLL(os.environ.get('OTCLI_LIBRARY', 'libopentxs-cli.so'))
+
+OUTPUT = ctypes.CFUNCTYPE(
+    None, ctypes.POINTER(ctypes.c_char), ctypes.c_size_t, ctypes.c_void_p)
+
+lib.otcli_open.restype = ctypes.c_void_p
+lib.otcli_exec.restype = ctypes.c_int
+lib.otcli_exec.argtypes = [
+    ctypes.c_void_p, ctypes.c_int, ctypes.POINTER(ctypes.c_char_p), OUTPUT,
+    ctypes.c_void_p]
+lib.otcli_close.argtypes = [ctypes.c_void_p]
+
+
+def run(cli, *args):
+    chunks = []
+
+    @OUTPUT
+    def collect(data, length, context):
+        chunks.append(ctypes.string_at(data, length))
+
+    argv = (ctypes.c_char_p * len(args))(*[a.encode() for a in args])
+    status = lib.otcli_exec(cli, len(args), argv, collect, None)
+    return status, b''.join(chunks).decode()
+
+
+cli = lib.otcli_open()
+if not cli:
+    sys.exit('Cannot start the opentxs client.')
+
+try:
+    for command in (['showservers'], ['showaccounts', '--format=ndjson']):
+        status, output = run(cli, *command)
+        print('opentxs %s -> %d' % (' '.join(command), status))
+        print(output)
+finally:
+    lib.otcli_close(cli)
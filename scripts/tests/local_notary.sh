@@ -0,0 +1,82 @@
+#!/bin/bash
+#
+# Runs a command against a private notary on the loopback interface, so
+# that commands which talk to a notary (transfer, acceptall, withdraw...)
+# can be benchmarked and profiled without any outside service.
+#
+# A temporary $HOME receives a copy of the opentxs-sample-data wallet,
+# whose server contract, unit definitions, nyms and accounts are already
+# registered with the sample notary. The notary and the command both run
+# with that $HOME, so the user's own wallet is never touched.
+#
+# usage: local_notary.sh <sample data folder> [command [arguments]]
+#
+# The sample data folder is the ot-sample-data folder of
+# https://github.com/Open-Transactions/opentxs-sample-data. Without a
+# command, "opentxs-bench --notary" is run, with OPENTXS_BENCH_ARGS added
+# to its arguments. Set OPENTXS_NOTARY to the notary executable (default
+# opentxs-notary) and OPENTXS_NOTARY_ARGS to pass it extra arguments.
+
+SERVER='r1fUoHwJOWCuK3WBAAySjmKYqsG6G2TYIxdqY6YNuuG'
+FTNYM='DYEB6U7dcpbwdGrftPnslNKz76BDuBTFAjiAgKaiY2n'
+
+DATA=$1
+if [ -z "${DATA}" ] || [ ! -d "${DATA}" ]; then
+    echo "usage: $0 <sample data folder> [command [arguments]]" >&2
+    exit 1
+fi
+DATA=$(cd "${DATA}" && pwd)
+shift
+
+NOTARY=${OPENTXS_NOTARY:-opentxs-notary}
+TIMEOUT=${OPENTXS_NOTARY_TIMEOUT:-30}
+
+BENCH_HOME=$(mktemp -d "${TMPDIR:-/tmp}/opentxs-notary-XXXXXX") || exit 1
+NOTARY_PID=
+
+function cleanup {
+    if [ -n "${NOTARY_PID}" ]; then
+        kill "${NOTARY_PID}" 2>/dev/null
+        wait "${NOTARY_PID}" 2>/dev/null
+    fi
+    rm -rf "${BENCH_HOME}"
+}
+trap cleanup EXIT
+
+mkdir "${BENCH_HOME}/.ot"
+cp -R "${DATA}/." "${BENCH_HOME}/.ot/" || exit 1
+
+# the sample mint, needed by withdraw and the other cash commands
+if [ -x "${DATA}/../createmint-sample.sh" ]; then
+    (cd "${DATA}/.." && HOME="${BENCH_HOME}" ./createmint-sample.sh) \
+        >"${BENCH_HOME}/createmint.log" 2>&1
+fi
+
+HOME="${BENCH_HOME}" ${NOTARY} ${OPENTXS_NOTARY_ARGS} \
+    >"${BENCH_HOME}/notary.log" 2>&1 &
+NOTARY_PID=$!
+
+# the notary is ready once the sample nym can reach it
+ELAPSED=0
+until HOME="${BENCH_HOME}" opentxs pingnotary --server "${SERVER}" \
+        --mynym "${FTNYM}" --dummy-passphrase >/dev/null 2>&1; do
+    if ! kill -0 "${NOTARY_PID}" 2>/dev/null; then
+        echo "The notary exited, see its log below." >&2
+        cat "${BENCH_HOME}/notary.log" >&2
+        exit 1
+    fi
+    if [ "${ELAPSED}" -ge "${TIMEOUT}" ]; then
+        echo "The notary did not answer within ${TIMEOUT} seconds." >&2
+        exit 1
+    fi
+    sleep 1
+    ELAPSED=$((ELAPSED + 1))
+done
+
+# the bench works on its own copy of the wallet, taken after the ping
+# above synchronized it with the notary
+if [ $# -eq 0 ]; then
+    set -- opentxs-bench --data "${BENCH_HOME}/.ot" --notary ${OPENTXS_BENCH_ARGS}
+fi
+
+HOME="${BENCH_HOME}" "$@"
@@ -0,0 +1,926 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CmdRegistry.hpp"
+
+#include "commands/CmdAcceptAll.hpp"
+#include "commands/CmdAcceptInbox.hpp"
+#include "commands/CmdAcceptIncoming.hpp"
+#include "commands/CmdAcceptInvoices.hpp"
+#include "commands/CmdAcceptMoney.hpp"
+#include "commands/CmdAcceptPayments.hpp"
+#include "commands/CmdAcceptReceipts.hpp"
+#include "commands/CmdAcceptTransfers.hpp"
+#include "commands/CmdAcknowledgeBailment.hpp"
+#include "commands/CmdAcknowledgeConnection.hpp"
+#include "commands/CmdAcknowledgeNotice.hpp"
+#include "commands/CmdAcknowledgeOutBailment.hpp"
+#include "commands/CmdActivitySummary.hpp"
+#include "commands/CmdAddAsset.hpp"
+#include "commands/CmdAddBitcoinAccount.hpp"
+#include "commands/CmdAddContact.hpp"
+#include "commands/CmdAddContract.hpp"
+#include "commands/CmdAddServer.hpp"
+#include "commands/CmdAddSignature.hpp"
+#include "commands/CmdAllocateBitcoinAddress.hpp"
+#include "commands/CmdArchivePeerReply.hpp"
+#ifndef _WIN32
+#include "commands/CmdArchiveRecords.hpp"
+#endif
+#include "commands/CmdAssignBitcoinAddress.hpp"
+#include "commands/CmdCanMessage.hpp"
+#include "commands/CmdCancel.hpp"
+#include "commands/CmdChangePw.hpp"
+#include "commands/CmdCheckNym.hpp"
+#include "commands/CmdClearExpired.hpp"
+#include "commands/CmdClearRecords.hpp"
+#include "commands/CmdConfirm.hpp"
+#include "commands/CmdContactName.hpp"
+#include "commands/CmdConvertPaymentCode.hpp"
+#include "commands/CmdDecode.hpp"
+#include "commands/CmdDecrypt.hpp"
+#include "commands/CmdDeposit.hpp"
+#include "commands/CmdDepositCheques.hpp"
+#include "commands/CmdDiscard.hpp"
+#include "commands/CmdEditAccount.hpp"
+#include "commands/CmdEditAsset.hpp"
+#include "commands/CmdEditNym.hpp"
+#include "commands/CmdEditServer.hpp"
+#include "commands/CmdEncode.hpp"
+#include "commands/CmdEncrypt.hpp"
+#include "commands/CmdExchangeBasket.hpp"
+#include "commands/CmdExportCash.hpp"
+#include "commands/CmdExportNym.hpp"
+#include "commands/CmdFindNym.hpp"
+#include "commands/CmdFindServer.hpp"
+#include "commands/CmdGetContact.hpp"
+#include "commands/CmdGetContract.hpp"
+#include "commands/CmdGetMarkets.hpp"
+#include "commands/CmdGetMyOffers.hpp"
+#include "commands/CmdGetOffers.hpp"
+#include "commands/CmdGetPeerReplies.hpp"
+#include "commands/CmdGetPeerReply.hpp"
+#include "commands/CmdGetPeerRequest.hpp"
+#include "commands/CmdGetPeerRequests.hpp"
+#include "commands/CmdGetReceipt.hpp"
+#include "commands/CmdHaveContact.hpp"
+#include "commands/CmdImportCash.hpp"
+#include "commands/CmdImportNym.hpp"
+#include "commands/CmdImportOtherNym.hpp"
+#include "commands/CmdImportPublicNym.hpp"
+#include "commands/CmdImportSeed.hpp"
+#include "commands/CmdInbox.hpp"
+#include "commands/CmdInpayments.hpp"
+#include "commands/CmdIssueAsset.hpp"
+#include "commands/CmdKillOffer.hpp"
+#include "commands/CmdKillPlan.hpp"
+#include "commands/CmdMarkRead.hpp"
+#include "commands/CmdMarkUnRead.hpp"
+#include "commands/CmdMergeContact.hpp"
+#include "commands/CmdModifyNym.hpp"
+#include "commands/CmdNewAccount.hpp"
+#include "commands/CmdNewAsset.hpp"
+#include "commands/CmdNewBasket.hpp"
+#include "commands/CmdNewKey.hpp"
+#include "commands/CmdNewNymHD.hpp"
+#include "commands/CmdNewNymLegacy.hpp"
+#include "commands/CmdNewOffer.hpp"
+#include "commands/CmdNotifyBailment.hpp"
+#include "commands/CmdOutbox.hpp"
+#include "commands/CmdOutpayment.hpp"
+#include "commands/CmdPairNode.hpp"
+#include "commands/CmdPairStatus.hpp"
+#include "commands/CmdPasswordDecrypt.hpp"
+#include "commands/CmdPasswordEncrypt.hpp"
+#include "commands/CmdPayDividend.hpp"
+#include "commands/CmdPayInvoice.hpp"
+#include "commands/CmdPeerStoreSecret.hpp"
+#include "commands/CmdPingNotary.hpp"
+#include "commands/CmdPreloadActivity.hpp"
+#include "commands/CmdPreloadThread.hpp"
+#include "commands/CmdProposePlan.hpp"
+#ifndef _WIN32
+#include "commands/CmdQueryRecords.hpp"
+#endif
+#include "commands/CmdRefresh.hpp"
+#include "commands/CmdRefreshAccount.hpp"
+#include "commands/CmdRefreshAll.hpp"
+#include "commands/CmdRefreshNym.hpp"
+#include "commands/CmdRegisterContractNym.hpp"
+#include "commands/CmdRegisterContractServer.hpp"
+#include "commands/CmdRegisterContractUnit.hpp"
+#include "commands/CmdRegisterNym.hpp"
+#include "commands/CmdRenameNym.hpp"
+#include "commands/CmdRequestAdmin.hpp"
+#include "commands/CmdRequestBailment.hpp"
+#include "commands/CmdRequestConnection.hpp"
+#include "commands/CmdRequestOutBailment.hpp"
+#include "commands/CmdSendCash.hpp"
+#include "commands/CmdSendCheque.hpp"
+#include "commands/CmdSendInvoice.hpp"
+#include "commands/CmdSendMessage.hpp"
+#include "commands/CmdSendVoucher.hpp"
+#include "commands/CmdServerAddClaim.hpp"
+#include "commands/CmdSetProfileValue.hpp"
+#include "commands/CmdShowAccount.hpp"
+#include "commands/CmdShowAccounts.hpp"
+#include "commands/CmdShowActive.hpp"
+#include "commands/CmdShowAssets.hpp"
+#include "commands/CmdShowBalance.hpp"
+#include "commands/CmdShowBasket.hpp"
+#include "commands/CmdShowContact.hpp"
+#include "commands/CmdShowContacts.hpp"
+#include "commands/CmdShowCredential.hpp"
+#include "commands/CmdShowCredentials.hpp"
+#include "commands/CmdShowExpired.hpp"
+#include "commands/CmdShowMarkets.hpp"
+#include "commands/CmdShowMessagable.hpp"
+#include "commands/CmdShowMint.hpp"
+#include "commands/CmdShowMyOffers.hpp"
+#include "commands/CmdShowNym.hpp"
+#include "commands/CmdShowNyms.hpp"
+#include "commands/CmdShowOffers.hpp"
+#include "commands/CmdShowPayable.hpp"
+#include "commands/CmdShowPayment.hpp"
+#include "commands/CmdShowPhrase.hpp"
+#include "commands/CmdShowProfile.hpp"
+#include "commands/CmdShowPurse.hpp"
+#include "commands/CmdShowRecords.hpp"
+#include "commands/CmdShowSeed.hpp"
+#include "commands/CmdShowServers.hpp"
+#include "commands/CmdShowThread.hpp"
+#include "commands/CmdShowThreads.hpp"
+#include "commands/CmdShowUnreadThreads.hpp"
+#include "commands/CmdShowWallet.hpp"
+#include "commands/CmdShowWords.hpp"
+#include "commands/CmdSignContract.hpp"
+#include "commands/CmdStartIntroductionServer.hpp"
+#include "commands/CmdTransfer.hpp"
+#include "commands/CmdTriggerClause.hpp"
+#include "commands/CmdUsageCredits.hpp"
+#include "commands/CmdVerifyPassword.hpp"
+#include "commands/CmdVerifyReceipt.hpp"
+#include "commands/CmdVerifySignature.hpp"
+#include "commands/CmdWithdrawCash.hpp"
+#include "commands/CmdWithdrawVoucher.hpp"
+#include "commands/CmdWriteCheque.hpp"
+#include "commands/CmdWriteInvoice.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+template <class T>
+CmdBase* create()
+{
+    return new T;
+}
+
+// The only place a command's name, category and help text are written
+// down; the command object finds its entry by its class, see entry().
+template <class T>
+constexpr CmdRegistry::Entry command(
+    const char* name,
+    Category category,
+    const char* help)
+{
+    return {name, category, help, &create<T>, &typeid(T)};
+}
+
+const CmdRegistry::Entry registry[] = {
+    command<CmdAcceptAll>(
+        "acceptall",
+        catAccounts,
+        "Accept all incoming transfers, receipts, payments, invoices."),
+    command<CmdAcceptInbox>(
+        "acceptinbox",
+        catAccounts,
+        "Accept all incoming transfers and receipts in myacct's inbox."),
+    command<CmdAcceptIncoming>(
+        "acceptincoming",
+        catAccounts,
+        "Accept all incoming payments in myacct's inbox."),
+    command<CmdAcceptInvoices>(
+        "acceptinvoices",
+        catAccounts,
+        "Pay all invoices in myacct's Nym's payments inbox on Server. "
+        "(Confused yet? New API fixes this kind of problem)."),
+    command<CmdAcceptMoney>(
+        "acceptmoney",
+        catAccounts,
+        "Accept all incoming transfers and payments into myacct."),
+    command<CmdAcceptPayments>(
+        "acceptpayments",
+        catAccounts,
+        "Accept all incoming payments in myacct's Nym's payments inbox on "
+        "Server. Confused yet?"),
+    command<CmdAcceptReceipts>(
+        "acceptreceipts",
+        catAccounts,
+        "Accept all incoming receipts in myacct's inbox."),
+    command<CmdAcceptTransfers>(
+        "accepttransfers",
+        catAccounts,
+        "Accept all incoming transfers in myacct's inbox."),
+    command<CmdAcknowledgeBailment>(
+        "acknowledgebailment",
+        catOtherUsers,
+        "Respond to a bailment request with deposit instructions"),
+    command<CmdAcknowledgeConnection>(
+        "acknowledgeconnection",
+        catOtherUsers,
+        "Respond to a connection request"),
+    command<CmdAcknowledgeNotice>(
+        "acknowledgenotice",
+        catOtherUsers,
+        "Acknowledge receipt of a peer notice"),
+    command<CmdAcknowledgeOutBailment>(
+        "acknowledgeoutbailment",
+        catOtherUsers,
+        "Respond to an out bailment request with withdrawal instructions"),
+    command<CmdActivitySummary>(
+        "activitysummary",
+        catOtherUsers,
+        "Display a summary of activity for a nym."),
+    command<CmdAddAsset>(
+        "addasset",
+        catWallet,
+        "Import an existing asset contract into your wallet."),
+    command<CmdAddBitcoinAccount>(
+        "addbitcoinaccount",
+        catBlockchain,
+        "Instantiate a BIP-44 account"),
+    command<CmdAddContact>(
+        "addcontact",
+        catOtherUsers,
+        "Add a new contact based on Nym ID"),
+    command<CmdAddContract>(
+        "addcontract",
+        catWallet,
+        "Edit a nym's contact credential data."),
+    command<CmdAddServer>(
+        "addserver",
+        catWallet,
+        "Import an existing server contract into your wallet."),
+    command<CmdAddSignature>(
+        "addsignature",
+        catAdmin,
+        "Add a signature to a contract without erasing others."),
+    command<CmdAllocateBitcoinAddress>(
+        "allocatebitcoinaddress",
+        catBlockchain,
+        "Derive bitcoin addresses in a Bip44 account"),
+    command<CmdArchivePeerReply>(
+        "archivepeerreply",
+        catOtherUsers,
+        "Move a reply to the processed box"),
+#ifndef _WIN32
+    command<CmdArchiveRecords>(
+        "archiverecords",
+        catMisc,
+        "Move record box and expired box receipts to the local archive."),
+#endif
+    command<CmdAssignBitcoinAddress>(
+        "assignbitcoinaddress",
+        catBlockchain,
+        "Assign a contact ID to a bitcoin address"),
+    command<CmdCancel>(
+        "cancel",
+        catInstruments,
+        "Cancel an uncashed outgoing instrument from outpayment box."),
+    command<CmdCanMessage>(
+        "canmessage",
+        catOtherUsers,
+        "Determine if prerequisites for messaging are met"),
+    command<CmdChangePw>(
+        "changepw",
+        catWallet,
+        "Change the master passphrase for the wallet."),
+    command<CmdCheckNym>(
+        "checknym",
+        catOtherUsers,
+        "Download hisnym's public key."),
+    command<CmdClearExpired>(
+        "clearexpired",
+        catMisc,
+        "Clear all mynym's expired records."),
+    command<CmdClearRecords>(
+        "clearrecords",
+        catMisc,
+        "Clear all archived records and receipts."),
+    command<CmdConfirm>(
+        "confirm",
+        catInstruments,
+        "Confirm your agreement to a smart contract or payment plan."),
+    command<CmdContactName>(
+        "contactname",
+        catOtherUsers,
+        "Retrieve the label for a contact"),
+    command<CmdConvertPaymentCode>(
+        "convertpaymentcode",
+        catMisc,
+        "Convert a BIP-47 payment code to a nym ID"),
+    command<CmdDecode>("decode", catAdmin, "Decode OT-armored input text."),
+    command<CmdDecrypt>(
+        "decrypt",
+        catAdmin,
+        "Decrypt encrypted input text using mynym's private key."),
+    command<CmdDeposit>(
+        "deposit",
+        catAccounts,
+        "Deposit cash, cheque, voucher, or invoice."),
+    command<CmdDepositCheques>(
+        "depositcheques",
+        catWallet,
+        "Deposit all undeposited cheques"),
+    command<CmdDiscard>(
+        "discard",
+        catInstruments,
+        "Discard uncashed incoming instruments from payments inbox."),
+    command<CmdEditAccount>(
+        "editaccount",
+        catWallet,
+        "Edit myacct's label, as it appears in your wallet."),
+    command<CmdEditAsset>(
+        "editasset",
+        catWallet,
+        "Edit mypurse's label, as it appears in your wallet."),
+    command<CmdEditNym>(
+        "editnym",
+        catWallet,
+        "Edit mynym's label, as it appears in your wallet."),
+    command<CmdEditServer>(
+        "editserver",
+        catWallet,
+        "Edit server's label, as it appears in your wallet."),
+    command<CmdEncode>(
+        "encode",
+        catAdmin,
+        "Encode plaintext input to OT-armored text."),
+    command<CmdEncrypt>(
+        "encrypt",
+        catAdmin,
+        "Encrypt plaintext input using hisnym's public key."),
+    command<CmdExchangeBasket>(
+        "exchangebasket",
+        catBaskets,
+        "Exchange in or out of a basket currency."),
+    command<CmdExportCash>(
+        "exportcash",
+        catInstruments,
+        "Export a cash purse."),
+    command<CmdExportNym>(
+        "exportnym",
+        catWallet,
+        "Export myym as a single importable file."),
+    command<CmdFindNym>(
+        "findnym",
+        catOtherUsers,
+        "Search all known servers for a nym."),
+    command<CmdFindServer>(
+        "findserver",
+        catOtherUsers,
+        "Search all known servers for a server contract."),
+    command<CmdGetContact>(
+        "getcontact",
+        catOtherUsers,
+        "Look up the contact ID for a nym ID"),
+    command<CmdGetInstrumentDefinition>(
+        "getcontract",
+        catAdmin,
+        "Download an asset or server contract by its ID."),
+    command<CmdGetMarkets>(
+        "getmarkets",
+        catMarkets,
+        "Download mynym's list of markets."),
+    command<CmdGetMyOffers>(
+        "getmyoffers",
+        catMarkets,
+        "Download mynym's list of market offers."),
+    command<CmdGetOffers>(
+        "getoffers",
+        catMarkets,
+        "Download mynym's list of market offers."),
+    command<CmdGetPeerRequests>(
+        "getpeerrequests",
+        catOtherUsers,
+        "Get a list of incoming peer request IDs"),
+    command<CmdGetPeerRequest>(
+        "getpeerrequest",
+        catOtherUsers,
+        "Show a base64-encoded peer request"),
+    command<CmdGetPeerReplies>(
+        "getpeerreplies",
+        catOtherUsers,
+        "Get a list of incoming peer reply IDs"),
+    command<CmdGetPeerReply>(
+        "getpeerreply",
+        catOtherUsers,
+        "Show a base64-encoded peer reply"),
+    command<CmdGetReceipt>(
+        "getreceipt",
+        catAdmin,
+        "Downloads a box receipt based on transaction nr."),
+    command<CmdHaveContact>(
+        "havecontact",
+        catOtherUsers,
+        "Determine if a contact exists"),
+    command<CmdImportCash>(
+        "importcash",
+        catInstruments,
+        "Import a pasted cash purse."),
+    command<CmdImportNym>("importnym", catWallet, "Import a pasted nym."),
+    command<CmdImportPublicNym>(
+        "importpublicnym",
+        catWallet,
+        "Import a public nym."),
+    command<CmdImportSeed>(
+        "importseed",
+        catWallet,
+        "Add a BIP39 seed to the wallet"),
+    command<CmdInbox>("inbox", catAccounts, "Show myacct's inbox."),
+    command<CmdInpayments>(
+        "inpayments",
+        catOtherUsers,
+        "Show mynym's incoming payments box."),
+    command<CmdIssueAsset>(
+        "issueasset",
+        catAdmin,
+        "Issue a currency contract onto an OT server."),
+    command<CmdKillOffer>(
+        "killoffer",
+        catMarkets,
+        "Kill an active market offer."),
+    command<CmdKillPlan>(
+        "killplan",
+        catInstruments,
+        "Kill an active payment plan."),
+    command<CmdMarkRead>(
+        "markread",
+        catOtherUsers,
+        "Mark a thread item as read."),
+    command<CmdMarkUnRead>(
+        "markunread",
+        catOtherUsers,
+        "Mark a thread item as unread."),
+    command<CmdMergeContact>(
+        "mergecontact",
+        catOtherUsers,
+        "Merge two contacts"),
+    command<CmdModifyNym>(
+        "modifynym",
+        catWallet,
+        "Edit a nym's contact credential data."),
+    command<CmdNewAccount>(
+        "newaccount",
+        catAccounts,
+        "Create a new asset account."),
+    command<CmdNewAsset>(
+        "newasset",
+        catAdmin,
+        "Create a new currency contract."),
+    command<CmdNewKey>("newkey", catAdmin, "Create a new symmetric key."),
+    command<CmdNewNymHD>(
+        "newnymhd",
+        catNyms,
+        "create a new nym using HD key derivation."),
+    command<CmdNewNymLegacy>(
+        "newnymlegacy",
+        catNyms,
+        "create a new OpenSSL-based RSA nym."),
+    command<CmdNewOffer>("newoffer", catMarkets, "Create a new market offer."),
+    command<CmdNotifyBailment>(
+        "notifybailment",
+        catOtherUsers,
+        "Notify a nym of a pending blockchain deposit"),
+    command<CmdImportOtherNym>(
+        "importothernym",
+        catWallet,
+        "Import a pasted nym."),
+    command<CmdOutbox>("outbox", catAccounts, "Show myacct's outbox."),
+    command<CmdNewBasket>(
+        "newbasket",
+        catBaskets,
+        "Create a new basket currency."),
+    command<CmdOutpayment>(
+        "outpayment",
+        catOtherUsers,
+        "Show mynym's outgoing payments box."),
+    command<CmdPairNode>("pairnode", catMisc, "Pair with a Stash Node"),
+    command<CmdPairStatus>("pairstatus", catMisc, "Pairing status"),
+    command<CmdPasswordDecrypt>(
+        "passworddecrypt",
+        catAdmin,
+        "Password-decrypt a ciphertext using a symmetric key."),
+    command<CmdPasswordEncrypt>(
+        "passwordencrypt",
+        catAdmin,
+        "Password-encrypt a plaintext using a symmetric key."),
+    command<CmdPayDividend>(
+        "paydividend",
+        catMarkets,
+        "Send dividend payout to all shareholders (in voucher form)."),
+    command<CmdPayInvoice>("payinvoice", catOtherUsers, "Pay an invoice."),
+    command<CmdPeerStoreSecret>(
+        "peerstoresecret",
+        catMisc,
+        "Request a nym to store a BIP-39 seed on behalf of the requestor"),
+    command<CmdPingNotary>(
+        "pingnotary",
+        catMisc,
+        "See if a notary is responsive."),
+    command<CmdPreloadActivity>(
+        "preloadactivity",
+        catOtherUsers,
+        "Cache messages in all of a nym's threads."),
+    command<CmdPreloadThread>(
+        "preloadthread",
+        catOtherUsers,
+        "Cache message in an activity thread."),
+    command<CmdProposePlan>(
+        "proposeplan",
+        catInstruments,
+        "as merchant, propose a payment plan to a customer."),
+#ifndef _WIN32
+    command<CmdQueryRecords>(
+        "queryrecords",
+        catMisc,
+        "Search the local archive of records."),
+#endif
+    command<CmdRefresh>(
+        "refresh",
+        catWallet,
+        "Performs both refreshnym and refreshaccount."),
+    command<CmdRefreshAccount>(
+        "refreshaccount",
+        catAccounts,
+        "Download myacct's latest intermediary files."),
+    command<CmdRefreshAll>(
+        "refreshall",
+        catWallet,
+        "Refresh all nyms in the wallet on all servers."),
+    command<CmdRefreshNym>(
+        "refreshnym",
+        catNyms,
+        "Download mynym's latest intermediary files."),
+    command<CmdRenameNym>(
+        "renamenym",
+        catWallet,
+        "Rename one of your own nyms and set appropriate claims."),
+    command<CmdRequestAdmin>(
+        "requestadmin",
+        catMisc,
+        "Request to become the admin nym for a server"),
+    command<CmdRequestBailment>(
+        "requestbailment",
+        catOtherUsers,
+        "Ask the issuer of a unit to accept a deposit"),
+    command<CmdRequestConnection>(
+        "requestconnection",
+        catOtherUsers,
+        "Request service connection info from another user"),
+    command<CmdRequestOutBailment>(
+        "requestoutbailment",
+        catOtherUsers,
+        "Ask the issuer of a unit to process a withdrawal"),
+    command<CmdRegisterContractNym>(
+        "registercontractnym",
+        catMisc,
+        "Upload a nym's credentials to a server without registering."),
+    command<CmdRegisterContractServer>(
+        "registercontractserver",
+        catMisc,
+        "Upload a server contract to a server."),
+    command<CmdRegisterContractUnit>(
+        "registercontractunit",
+        catMisc,
+        "Upload a server contract to a server."),
+    command<CmdRegisterNym>(
+        "registernym",
+        catAdmin,
+        "Register mynym onto an OT server."),
+    command<CmdSendCash>(
+        "sendcash",
+        catOtherUsers,
+        "Send cash from mypurse to recipient, withdraw if necessary."),
+    command<CmdSendCheque>(
+        "sendcheque",
+        catOtherUsers,
+        "Write a cheque and then send it to the recipient."),
+    command<CmdSendInvoice>(
+        "sendinvoice",
+        catOtherUsers,
+        "Write an invoice and then send it to the recipient."),
+    command<CmdSendMessage>(
+        "sendmessage",
+        catOtherUsers,
+        "Send a message to hisnym's in-mail."),
+    command<CmdSendVoucher>(
+        "sendvoucher",
+        catOtherUsers,
+        "Withdraw a voucher and then send it to the recipient."),
+    command<CmdServerAddClaim>(
+        "serveraddclaim",
+        catMisc,
+        "Request the server to add a claim to its nym credentials"),
+    command<CmdSetProfileValue>(
+        "setprofilevalue",
+        catNyms,
+        "Add data to a profile"),
+    command<CmdShowAccount>("showaccount", catAccounts, "Show myacct's stats."),
+    command<CmdShowAccounts>(
+        "showaccounts",
+        catWallet,
+        "Show the asset accounts in the wallet."),
+    command<CmdShowActive>(
+        "showactive",
+        catInstruments,
+        "Show the active cron item IDs, or the details of one by ID."),
+    command<CmdShowAssets>(
+        "showassets",
+        catWallet,
+        "Show the currency contracts in the wallet."),
+    command<CmdShowBalance>(
+        "showbalance",
+        catAccounts,
+        "Show myacct's balance."),
+    command<CmdShowBasket>(
+        "showbasket",
+        catBaskets,
+        "Show basket currency details."),
+    command<CmdShowContact>(
+        "showcontact",
+        catOtherUsers,
+        "Display contact data"),
+    command<CmdShowContacts>(
+        "showcontacts",
+        catOtherUsers,
+        "Show the contact list for a nym in the wallet."),
+    command<CmdShowCredential>(
+        "showcredential",
+        catNyms,
+        "Show a specific credential in detail."),
+    command<CmdShowCredentials>(
+        "showcredentials",
+        catNyms,
+        "Show mynym's credentials."),
+    command<CmdShowExpired>(
+        "showexpired",
+        catMisc,
+        "Show mynym's expired record box."),
+    command<CmdShowMarkets>(
+        "showmarkets",
+        catMarkets,
+        "Show the list of markets."),
+    command<CmdShowMessagable>(
+        "showmessagable",
+        catOtherUsers,
+        "Show the list of messabable contacts for a nym in the wallet."),
+    command<CmdShowMint>(
+        "showmint",
+        catAdmin,
+        "Show mint file for specific instrument definition id. Download if "
+        "necessary."),
+    command<CmdShowMyOffers>(
+        "showmyoffers",
+        catMarkets,
+        "Show mynym's offers on a particular server."),
+    command<CmdShowNym>("shownym", catNyms, "Show mynym's statistics."),
+    command<CmdShowNyms>("shownyms", catWallet, "Show the nyms in the wallet."),
+    command<CmdShowOffers>(
+        "showoffers",
+        catMarkets,
+        "Show all offers on a particular server and market."),
+    command<CmdShowPayable>(
+        "showpayable",
+        catOtherUsers,
+        "Show the list of payable contacts for a currency."),
+    command<CmdShowPayment>(
+        "showpayment",
+        catOtherUsers,
+        "Show details of an incoming payment in the payments inbox."),
+    command<CmdShowProfile>("showprofile", catNyms, "Display profile data"),
+    command<CmdShowPhrase>(
+        "showphrase",
+        catWallet,
+        "Show wallet BIP39 passphrase."),
+    command<CmdShowRecords>(
+        "showrecords",
+        catMisc,
+        "Show contents of record box."),
+    command<CmdShowPurse>(
+        "showpurse",
+        catWallet,
+        "Show contents of a cash purse."),
+    command<CmdShowSeed>(
+        "showseed",
+        catWallet,
+        "Show the wallet BIP32 seed as a hex string."),
+    command<CmdShowServers>(
+        "showservers",
+        catWallet,
+        "Show the server contracts in the wallet."),
+    command<CmdShowThread>(
+        "showthread",
+        catOtherUsers,
+        "Display the contents of an activity thread."),
+    command<CmdShowThreads>(
+        "showthreads",
+        catOtherUsers,
+        "List activity threads for the specified user."),
+    command<CmdShowUnreadThreads>(
+        "showunreadthreads",
+        catOtherUsers,
+        "List activity threads containing unread items for the specified "
+        "user."),
+    command<CmdShowWallet>("showwallet", catWallet, "Show wallet contents."),
+    command<CmdShowWords>(
+        "showwords",
+        catWallet,
+        "Show wallet BIP39 seed as a word list."),
+    command<CmdSignContract>(
+        "signcontract",
+        catAdmin,
+        "Add a signature to a contract and erase all others"),
+    command<CmdStartIntroductionServer>(
+        "startintroductionserver",
+        catWallet,
+        "Initialize state machine for the introduction server"),
+    command<CmdTransfer>(
+        "transfer",
+        catAccounts,
+        "Send a transfer from myacct to hisacct."),
+    command<CmdTriggerClause>(
+        "triggerclause",
+        catInstruments,
+        "Trigger a clause on a running smart contract."),
+    command<CmdUsageCredits>(
+        "usagecredits",
+        catOtherUsers,
+        "Give or take away hisnym's usage credits."),
+    command<CmdVerifyPassword>(
+        "verifypassword",
+        catWallet,
+        "Prompt for wallet passphrase entry."),
+    command<CmdVerifyReceipt>(
+        "verifyreceipt",
+        catAccounts,
+        "Verify your intermediary files against last signed receipt."),
+    command<CmdVerifySignature>(
+        "verifysignature",
+        catAdmin,
+        "Verify hisnym's signature on a pasted contract."),
+    command<CmdWithdrawCash>(
+        "withdraw",
+        catInstruments,
+        "Withdraw from myacct as cash into local purse."),
+    command<CmdWithdrawVoucher>(
+        "withdrawvoucher",
+        catInstruments,
+        "Withdraw from myacct as a voucher (cashier's cheque)."),
+    command<CmdWriteCheque>(
+        "writecheque",
+        catInstruments,
+        "Write a cheque and print it out to the screen."),
+    command<CmdWriteInvoice>(
+        "writeinvoice",
+        catInstruments,
+        "Write an invoice and print it out to the screen.")};
+
+const size_t registrySize = sizeof(registry) / sizeof(registry[0]);
+
+// commands that can add, remove or rename nyms, accounts, servers or units,
+// downloads from a notary included
+const char* walletCommands[] = {"addasset",
+                                "addbitcoinaccount",
+                                "addcontract",
+                                "addserver",
+                                "checknym",
+                                "editaccount",
+                                "editasset",
+                                "editnym",
+                                "editserver",
+                                "exportcash",
+                                "getcontract",
+                                "importnym",
+                                "importothernym",
+                                "importpublicnym",
+                                "importseed",
+                                "issueasset",
+                                "newaccount",
+                                "newasset",
+                                "newbasket",
+                                "newnymhd",
+                                "newnymlegacy",
+                                "pairnode",
+                                "registercontractnym",
+                                "registercontractserver",
+                                "registercontractunit",
+                                "registernym",
+                                "renamenym",
+                                nullptr};
+}  // namespace
+
+CmdRegistry::CmdRegistry()
+    : index_(registrySize)
+    , cmds_(registrySize)
+{
+    for (size_t i = 0; i < registrySize; i++) {
+        index_.emplace(registry[i].command, i);
+    }
+}
+
+CmdRegistry::~CmdRegistry() {}
+
+const CmdRegistry::Entry& CmdRegistry::entry(size_t index)
+{
+    OT_ASSERT(index < registrySize);
+    return registry[index];
+}
+
+const CmdRegistry::Entry* CmdRegistry::entry(const CmdBase& cmd)
+{
+    static const auto types = []() {
+        unordered_map<type_index, const Entry*> types;
+        for (const auto& entry : registry) {
+            types.emplace(*entry.type, &entry);
+        }
+        return types;
+    }();
+
+    auto found = types.find(typeid(cmd));
+    return types.end() == found ? nullptr : found->second;
+}
+
+size_t CmdRegistry::size() { return registrySize; }
+
+bool CmdRegistry::changesWallet(const string& command)
+{
+    for (int i = 0; nullptr != walletCommands[i]; i++) {
+        if (command == walletCommands[i]) { return true; }
+    }
+    return false;
+}
+
+int32_t CmdRegistry::find(const string& command) const
+{
+    auto found = index_.find(command);
+    if (found == index_.end()) { return -1; }
+    return found->second;
+}
+
+CmdBase& CmdRegistry::get(size_t index)
+{
+    OT_ASSERT(index < registrySize);
+
+    auto& cmd = cmds_[index];
+    if (!cmd) { cmd.reset(registry[index].create()); }
+
+    return *cmd;
+}
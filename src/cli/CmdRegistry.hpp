@@ -0,0 +1,93 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_CMDREGISTRY_HPP__
+#define __OPENTXS_CMDREGISTRY_HPP__
+
+#include "commands/CmdBase.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace opentxs
+{
+
+// Static table of every opentxs command. The name, category and help text
+// of a command are only written down here, so they can be listed without
+// constructing it; the command object itself is only created the first
+// time it is dispatched, and reads them from its entry.
+class CmdRegistry
+{
+public:
+    struct Entry {
+        const char* command;
+        Category category;
+        const char* help;
+        CmdBase* (*create)();
+        // the class create() constructs
+        const std::type_info* type;
+    };
+
+    CmdRegistry();
+    ~CmdRegistry();
+
+    static const Entry& entry(size_t index);
+    // the entry of a command object, nullptr when its class is not in the
+    // table
+    static const Entry* entry(const CmdBase& cmd);
+    static size_t size();
+    // true for the commands that can add, remove or rename nyms, accounts,
+    // servers or units
+    static bool changesWallet(const std::string& command);
+
+    // returns -1 when there is no such command
+    int32_t find(const std::string& command) const;
+    CmdBase& get(size_t index);
+
+private:
+    std::unordered_map<std::string_view, size_t> index_;
+    std::vector<std::unique_ptr<CmdBase>> cmds_;
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_CMDREGISTRY_HPP__
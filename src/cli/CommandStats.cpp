@@ -0,0 +1,220 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CommandStats.hpp"
+
+#include "MainOption.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Samples {
+    vector<double> ms;
+    double notaryMs{0};
+};
+
+bool collecting = false;
+string outputPath;
+mutex samplesLock;
+map<string, Samples> samples;
+
+// notary time of the command running on this thread
+thread_local double notaryMs = 0;
+
+double ms_since(chrono::steady_clock::time_point started)
+{
+    return chrono::duration<double, milli>(
+               chrono::steady_clock::now() - started)
+        .count();
+}
+
+// nearest rank percentile of sorted samples
+double percentile(const vector<double>& sorted, int p)
+{
+    size_t rank = (p * sorted.size() + 99) / 100;
+    return sorted[max<size_t>(rank, 1) - 1];
+}
+
+bool ends_with(const string& s, const string& suffix)
+{
+    return s.length() >= suffix.length() &&
+           0 == s.compare(s.length() - suffix.length(), suffix.length(),
+                          suffix);
+}
+}  // namespace
+
+void CommandStats::enable(int& argc, char* argv[])
+{
+    collecting = takeMainOption(argc, argv, "stats", outputPath);
+}
+
+bool CommandStats::enabled() { return collecting; }
+
+CommandStats::Command::Command(const char* name)
+    : name_(name)
+    , started_(chrono::steady_clock::now())
+    , outerNotaryMs_(notaryMs)
+{
+    notaryMs = 0;
+}
+
+CommandStats::Command::~Command()
+{
+    double ms = ms_since(started_);
+    double notary = notaryMs;
+    notaryMs = outerNotaryMs_;
+
+    if (!collecting) { return; }
+
+    lock_guard<mutex> guard(samplesLock);
+    Samples& command = samples[name_];
+    command.ms.push_back(ms);
+    command.notaryMs += notary;
+}
+
+CommandStats::RoundTrip::RoundTrip()
+    : started_(chrono::steady_clock::now())
+{
+}
+
+CommandStats::RoundTrip::~RoundTrip() { notaryMs += ms_since(started_); }
+
+void CommandStats::report()
+{
+    if (!collecting) { return; }
+
+    lock_guard<mutex> guard(samplesLock);
+
+    double totalMs = 0;
+    double totalNotaryMs = 0;
+    for (auto& command : samples) {
+        sort(command.second.ms.begin(), command.second.ms.end());
+        for (double ms : command.second.ms) { totalMs += ms; }
+        totalNotaryMs += command.second.notaryMs;
+    }
+
+    ostringstream table;
+    table << fixed << setprecision(1) << "\nCommand latency (ms):\n"
+          << left << setw(22) << "  command" << right << setw(7) << "count"
+          << setw(10) << "min" << setw(10) << "p50" << setw(10) << "p95"
+          << setw(10) << "p99" << setw(10) << "max" << setw(12) << "notary"
+          << "\n";
+    for (const auto& command : samples) {
+        const auto& ms = command.second.ms;
+        table << "  " << left << setw(20) << command.first << right
+              << setw(7) << ms.size() << setw(10) << ms.front() << setw(10)
+              << percentile(ms, 50) << setw(10) << percentile(ms, 95)
+              << setw(10) << percentile(ms, 99) << setw(10) << ms.back()
+              << setw(12) << command.second.notaryMs << "\n";
+    }
+    table << "\nTotal " << totalMs << " ms: " << totalNotaryMs
+          << " ms in notary round trips, " << totalMs - totalNotaryMs
+          << " ms local work.\n";
+    cout << table.str();
+
+    if ("" == outputPath) { return; }
+
+    ostringstream out;
+    out << fixed << setprecision(3);
+    if (ends_with(outputPath, ".prom")) {
+        out << "# HELP opentxs_cli_command_ms Wall time of CLI commands.\n"
+               "# TYPE opentxs_cli_command_ms summary\n";
+        for (const auto& command : samples) {
+            const auto& ms = command.second.ms;
+            const string& name = command.first;
+            for (int p : {50, 95, 99}) {
+                out << "opentxs_cli_command_ms{command=\"" << name
+                    << "\",quantile=\"0." << p << "\"} "
+                    << percentile(ms, p) << "\n";
+            }
+            double sum = 0;
+            for (double value : ms) { sum += value; }
+            out << "opentxs_cli_command_ms_sum{command=\"" << name << "\"} "
+                << sum << "\n"
+                << "opentxs_cli_command_ms_count{command=\"" << name
+                << "\"} " << ms.size() << "\n";
+        }
+        out << "# HELP opentxs_cli_notary_ms Time spent in notary round "
+               "trips.\n"
+               "# TYPE opentxs_cli_notary_ms counter\n";
+        for (const auto& command : samples) {
+            out << "opentxs_cli_notary_ms{command=\"" << command.first
+                << "\"} " << command.second.notaryMs << "\n";
+        }
+    } else {
+        out << "{\n  \"commands\": {";
+        const char* separator = "\n";
+        for (const auto& command : samples) {
+            const auto& ms = command.second.ms;
+            out << separator << "    \"" << command.first
+                << "\": {\"count\": " << ms.size()
+                << ", \"min_ms\": " << ms.front()
+                << ", \"p50_ms\": " << percentile(ms, 50)
+                << ", \"p95_ms\": " << percentile(ms, 95)
+                << ", \"p99_ms\": " << percentile(ms, 99)
+                << ", \"max_ms\": " << ms.back()
+                << ", \"notary_ms\": " << command.second.notaryMs << "}";
+            separator = ",\n";
+        }
+        out << "\n  },\n  \"total_ms\": " << totalMs
+            << ",\n  \"notary_ms\": " << totalNotaryMs
+            << ",\n  \"local_ms\": " << totalMs - totalNotaryMs << "\n}\n";
+    }
+
+    ofstream file(outputPath.c_str(), ios::out | ios::trunc);
+    file << out.str();
+    if (!file.good()) {
+        otOut << "Error: cannot write command stats: " << outputPath << "\n";
+    }
+}
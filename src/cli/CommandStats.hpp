@@ -0,0 +1,90 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_COMMANDSTATS_HPP__
+#define __OPENTXS_COMMANDSTATS_HPP__
+
+#include <chrono>
+#include <string>
+
+namespace opentxs
+{
+
+// Per-command latency statistics for --stats[=file]. Records the wall time
+// of every command that runs, split into time spent waiting on notary
+// round trips and local work, and reports count, min, p50, p95, p99 and
+// max per command. Commands running on different threads are accounted
+// separately. Nothing is recorded unless stats have been enabled.
+class CommandStats
+{
+public:
+    // removes --stats[=file] from argv and enables the statistics when it
+    // was present; a file ending in .prom gets the Prometheus text format,
+    // any other file JSON
+    static void enable(int& argc, char* argv[]);
+    static bool enabled();
+
+    // prints the table, and writes the file when one was given
+    static void report();
+
+    // times one command from construction to destruction
+    class Command
+    {
+    public:
+        explicit Command(const char* name);
+        ~Command();
+
+    private:
+        const char* name_;
+        std::chrono::steady_clock::time_point started_;
+        double outerNotaryMs_;
+    };
+
+    // times one notary round trip of the running command
+    class RoundTrip
+    {
+    public:
+        RoundTrip();
+        ~RoundTrip();
+
+    private:
+        std::chrono::steady_clock::time_point started_;
+    };
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_COMMANDSTATS_HPP__
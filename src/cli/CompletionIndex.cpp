@@ -0,0 +1,261 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CompletionIndex.hpp"
+
+#include "CmdRegistry.hpp"
+#include "MainOption.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// format version, the first line of the index
+const int VERSION = 1;
+
+mutex idsLock;
+
+// "--name <a|b|c>" takes one of a few words; "<indices|all>" names its
+// own option as an alternative, which is no value to complete
+vector<string> valueSet(const char* arg, const string& name)
+{
+    vector<string> values;
+
+    const char* open = strchr(arg, '<');
+    const char* close = nullptr == open ? nullptr : strchr(open, '>');
+    if (nullptr == close) { return values; }
+
+    string choices(open + 1, close);
+    if (string::npos == choices.find('|')) { return values; }
+
+    size_t begin = 0;
+    while (begin <= choices.length()) {
+        size_t end = choices.find('|', begin);
+        if (string::npos == end) { end = choices.length(); }
+        string value = choices.substr(begin, end - begin);
+        begin = end + 1;
+
+        bool word = !value.empty();
+        for (auto& c : value) {
+            word = word && (isalnum(c) || '-' == c);
+            c = tolower(c);
+        }
+        if (!word) { return vector<string>(); }
+        if (name != value) { values.push_back(value); }
+    }
+
+    return values;
+}
+
+void writeId(ostream& out, const char* kind, const string& id, string label)
+{
+    // a label is free text, keep it on one line
+    replace(label.begin(), label.end(), '\t', ' ');
+    replace(label.begin(), label.end(), '\n', ' ');
+    out << kind << '\t' << id << '\t' << label << '\n';
+}
+
+template <typename Id, typename Label>
+void listIds(
+    ostream& out,
+    const char* kind,
+    int32_t count,
+    const Id& id,
+    const Label& label)
+{
+    for (int32_t i = 0; i < count; i++) {
+        string value = id(i);
+        if (!value.empty()) { writeId(out, kind, value, label(value)); }
+    }
+}
+void writeIndex(ostream& out)
+{
+    out << "# opentxs completion index " << VERSION << "\n";
+
+    // every command accepts these, see MainOption.hpp
+    out << "flags";
+    for (int i = 0; nullptr != GLOBAL_FLAGS[i]; i++) {
+        out << " " << GLOBAL_FLAGS[i];
+    }
+    for (int i = 0; nullptr != MAIN_OPTIONS[i]; i++) {
+        out << " " << MAIN_OPTIONS[i];
+    }
+    out << "\nglobal";
+    for (int i = 0; nullptr != GLOBAL_OPTIONS[i]; i++) {
+        out << " " << GLOBAL_OPTIONS[i];
+    }
+    out << "\n";
+    out << "values * format text ndjson\n";
+
+    // handled by Opentxs::processCommand() itself
+    out << "command help\ncommand list\ncommand version\n";
+
+    for (size_t i = 0; i < CmdRegistry::size(); i++) {
+        const auto& entry = CmdRegistry::entry(i);
+        unique_ptr<CmdBase> cmd(entry.create());
+        const size_t count = cmd->getArgumentCount();
+
+        out << "command " << entry.command;
+        for (size_t j = 0; j < count; j++) {
+            out << " " << cmd->getArgument(j).name;
+        }
+        out << "\n";
+
+        // options of this command that take no value
+        bool switches = false;
+        for (size_t j = 0; j < count; j++) {
+            const Argument& arg = cmd->getArgument(j);
+            if (!arg.flag) { continue; }
+            if (!switches) { out << "switches " << entry.command; }
+            out << " " << arg.name;
+            switches = true;
+        }
+        if (switches) { out << "\n"; }
+
+        for (size_t j = 0; j < count; j++) {
+            const Argument& arg = cmd->getArgument(j);
+            auto values = valueSet(arg.usage, string(arg.name));
+            if (values.empty()) { continue; }
+
+            out << "values " << entry.command << " " << arg.name;
+            for (const auto& value : values) { out << " " << value; }
+            out << "\n";
+        }
+    }
+}
+}  // namespace
+
+bool CompletionIndex::write(const string& path)
+{
+    if (path.empty()) {
+        writeIndex(cout);
+        cout.flush();
+        return cout.good();
+    }
+
+    ofstream out(path, ios::trunc);
+    writeIndex(out);
+    out.close();
+    if (!out.good()) { cerr << "Cannot write " << path << "\n"; }
+    return out.good();
+}
+
+string CompletionIndex::idsPath()
+{
+    String configPath(OTPaths::AppDataFolder()), idsFile;
+    bool buildFullPathSuccess = OTPaths::RelativeToCanonical(
+        idsFile, configPath, String("completion-ids"));
+    OT_ASSERT_MSG(buildFullPathSuccess, "Unable to set Full Path");
+    return idsFile.Get();
+}
+
+void CompletionIndex::refreshIds(const string& command)
+{
+    // other commands only write the file when it is missing, which is
+    // checked once per process rather than after every command
+    static atomic<bool> checked{false};
+    bool changed = CmdRegistry::changesWallet(command);
+    if (!changed && checked.exchange(true)) { return; }
+
+    string path = idsPath();
+    struct stat info;
+    if (!changed && 0 == stat(path.c_str(), &info)) { return; }
+
+    // parallel script lines may finish wallet commands at the same time
+    lock_guard<mutex> lock(idsLock);
+
+    // completion reads the file at any time, so it is replaced in one step
+    string temporary = path + ".tmp";
+    {
+        ofstream out(temporary, ios::trunc);
+        listIds(
+            out,
+            "nym",
+            SwigWrap::GetNymCount(),
+            [](int32_t i) { return SwigWrap::GetNym_ID(i); },
+            [](const string& id) { return SwigWrap::GetNym_Name(id); });
+        listIds(
+            out,
+            "server",
+            SwigWrap::GetServerCount(),
+            [](int32_t i) { return SwigWrap::GetServer_ID(i); },
+            [](const string& id) { return SwigWrap::GetServer_Name(id); });
+        listIds(
+            out,
+            "unit",
+            SwigWrap::GetAssetTypeCount(),
+            [](int32_t i) { return SwigWrap::GetAssetType_ID(i); },
+            [](const string& id) { return SwigWrap::GetAssetType_Name(id); });
+        for (const auto& it : OT::App().DB().AccountList()) {
+            const auto& myacct = std::get<0>(it);
+            writeId(
+                out,
+                "account",
+                myacct,
+                SwigWrap::GetAccountWallet_Name(myacct));
+        }
+        if (!out.good()) {
+            remove(temporary.c_str());
+            return;
+        }
+    }
+
+    if (0 != rename(temporary.c_str(), path.c_str())) {
+        otWarn << "Cannot write " << path << "\n";
+        remove(temporary.c_str());
+    }
+}
@@ -0,0 +1,70 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_COMPLETIONINDEX_HPP__
+#define __OPENTXS_COMPLETIONINDEX_HPP__
+
+#include <string>
+
+namespace opentxs
+{
+
+// Data files for scripts/bash_completion.d, so that TAB completion never has
+// to start a client.
+//
+// The index lists every command with its options, and the values of the
+// options that only take a few. It depends on nothing but the command
+// registry and is generated with "opentxs --completion-index", by the build
+// unless it is cross-compiling.
+//
+// The ID cache (completion-ids in the data folder) lists the nyms, accounts,
+// servers and units of the wallet with their labels. It is rewritten after
+// every command that can change one of those lists, and after the first
+// command of a process that finds it missing.
+class CompletionIndex
+{
+public:
+    // writes the index to path, or to stdout when path is empty
+    static bool write(const std::string& path);
+
+    static std::string idsPath();
+    // called after command succeeded
+    static void refreshIds(const std::string& command);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_COMPLETIONINDEX_HPP__
@@ -0,0 +1,140 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "JsonRow.hpp"
+
+#include <stdint.h>
+#include <string.h>
+#include <ostream>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+JsonRow::JsonRow(ostream& out)
+    : out_(out)
+    , first_(true)
+{
+    out_ << '{';
+}
+
+JsonRow::~JsonRow() { out_ << "}\n"; }
+
+JsonRow& JsonRow::field(const char* name, const string& value)
+{
+    this->name(name);
+    quoted(value.data(), value.length());
+    return *this;
+}
+
+JsonRow& JsonRow::field(const char* name, const char* value)
+{
+    this->name(name);
+    quoted(value, strlen(value));
+    return *this;
+}
+
+JsonRow& JsonRow::field(const char* name, int32_t value)
+{
+    this->name(name);
+    out_ << value;
+    return *this;
+}
+
+JsonRow& JsonRow::field(const char* name, int64_t value)
+{
+    this->name(name);
+    out_ << value;
+    return *this;
+}
+
+JsonRow& JsonRow::field(const char* name, bool value)
+{
+    this->name(name);
+    out_ << (value ? "true" : "false");
+    return *this;
+}
+
+void JsonRow::name(const char* name)
+{
+    if (!first_) { out_ << ','; }
+    first_ = false;
+
+    // field names are literals chosen by the commands, never user data
+    out_ << '"' << name << "\":";
+}
+
+void JsonRow::quoted(const char* value, size_t length)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out_ << '"';
+
+    // copy runs of characters that need no escaping in one write
+    const char* run = value;
+    const char* end = value + length;
+    for (const char* p = value; p < end; p++) {
+        unsigned char c = *p;
+        if ('"' != c && '\\' != c && 0x20 <= c) { continue; }
+
+        out_.write(run, p - run);
+        run = p + 1;
+        switch (c) {
+            case '"':
+                out_ << "\\\"";
+                break;
+            case '\\':
+                out_ << "\\\\";
+                break;
+            case '\n':
+                out_ << "\\n";
+                break;
+            case '\r':
+                out_ << "\\r";
+                break;
+            case '\t':
+                out_ << "\\t";
+                break;
+            default:
+                out_ << "\\u00" << hex[c >> 4] << hex[c & 0xf];
+        }
+    }
+    out_.write(run, end - run);
+
+    out_ << '"';
+}
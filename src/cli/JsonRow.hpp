@@ -0,0 +1,76 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_JSONROW_HPP__
+#define __OPENTXS_JSONROW_HPP__
+
+#include <stdint.h>
+#include <ostream>
+#include <string>
+
+namespace opentxs
+{
+
+// One line of --format=ndjson output. The object is written to the stream
+// field by field while the row is being built, and terminated by a newline
+// when the row goes out of scope, so a listing never has to hold more than
+// the current row in memory.
+class JsonRow
+{
+public:
+    explicit JsonRow(std::ostream& out);
+    ~JsonRow();
+
+    JsonRow& field(const char* name, const std::string& value);
+    JsonRow& field(const char* name, const char* value);
+    JsonRow& field(const char* name, int32_t value);
+    JsonRow& field(const char* name, int64_t value);
+    JsonRow& field(const char* name, bool value);
+
+private:
+    std::ostream& out_;
+    bool first_;
+
+    JsonRow(const JsonRow&) = delete;
+    JsonRow& operator=(const JsonRow&) = delete;
+
+    void name(const char* name);
+    void quoted(const char* value, size_t length);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_JSONROW_HPP__
@@ -0,0 +1,237 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "LedgerSnapshot.hpp"
+
+#include "Trace.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// an ID that is only set for some receipts, "" otherwise
+template <typename Source, typename Get>
+string displayId(Source& source, const Get& get)
+{
+    Identifier id;
+    if (!(source.*get)(id)) { return ""; }
+    return id.str();
+}
+
+Ledger* loadBox(
+    LedgerSnapshot::Box box,
+    const Identifier& server,
+    const Identifier& nym,
+    const Identifier& account)
+{
+    Trace::Span span("OT_API::LoadBox");
+    const auto& api = OT::App().API().OTAPI();
+    switch (box) {
+        case LedgerSnapshot::Box::Inbox:
+            return api.LoadInbox(server, nym, account);
+        case LedgerSnapshot::Box::Outbox:
+            return api.LoadOutbox(server, nym, account);
+        case LedgerSnapshot::Box::RecordBox:
+            return api.LoadRecordBox(server, nym, account);
+        case LedgerSnapshot::Box::ExpiredBox:
+            return api.LoadExpiredBox(server, nym);
+        case LedgerSnapshot::Box::PaymentInbox:
+            return api.LoadPaymentInbox(server, nym);
+    }
+    return nullptr;
+}
+}  // namespace
+
+bool LedgerSnapshot::load(
+    Box box,
+    const string& server,
+    const string& nym,
+    const string& account,
+    const Paging& paging)
+{
+    Trace::Span span("LedgerSnapshot::load");
+    clear();
+
+    const Identifier nymID(nym);
+    unique_ptr<Ledger> ledger(
+        loadBox(box, Identifier(server), nymID, Identifier(account)));
+    if (!ledger) { return false; }
+
+    ConstNym owner;
+    if (Box::PaymentInbox == box) {
+        owner = OT::App().Wallet().Nym(nymID);
+        if (!owner) { return false; }
+    }
+
+    const int32_t items = ledger->GetTransactionCount();
+    if (0 > items) { return false; }
+
+    // the box itself only holds abbreviated receipts, which have the date
+    // but lack the sender and recipient
+    vector<int64_t> dates;
+    dates.reserve(items);
+    for (int32_t i = 0; i < items; i++) {
+        OTTransaction* tx = ledger->GetTransactionByIndex(i);
+        if (nullptr == tx) {
+            otOut << "Error: cannot load receipt at index: " << i << "\n";
+            return false;
+        }
+        dates.push_back(tx->GetDateSigned());
+    }
+
+    const vector<size_t> positions = paging.select(dates);
+    total = items;
+    reserve(positions.size());
+
+    for (size_t i : positions) {
+        OTTransaction* tx = ledger->GetTransactionByIndex(i);
+        if (tx->IsAbbreviated()) {
+            // replaces the abbreviated receipt in the ledger
+            const int64_t number = tx->GetTransactionNum();
+            Trace::Span receipt("Ledger::LoadBoxReceipt");
+            if (!ledger->LoadBoxReceipt(number)) {
+                otOut << "Error: cannot load box receipt for transaction: "
+                      << number << "\n";
+                clear();
+                return false;
+            }
+            tx = ledger->GetTransactionByIndex(i);
+        }
+        if (nullptr == tx) {
+            otOut << "Error: cannot load receipt at index: " << i << "\n";
+            clear();
+            return false;
+        }
+
+        position.push_back(i);
+        date.push_back(dates[i]);
+        number.push_back(tx->GetTransactionNum());
+        reference.push_back(tx->GetReferenceNumForDisplay());
+
+        if (Box::PaymentInbox != box) {
+            amount.push_back(tx->GetReceiptAmount());
+            type.push_back(tx->GetTypeString());
+            senderNym.push_back(
+                displayId(*tx, &OTTransaction::GetSenderNymIDForDisplay));
+            senderAccount.push_back(
+                displayId(*tx, &OTTransaction::GetSenderAcctIDForDisplay));
+            recipientNym.push_back(
+                displayId(*tx, &OTTransaction::GetRecipientNymIDForDisplay));
+            recipientAccount.push_back(
+                displayId(*tx, &OTTransaction::GetRecipientAcctIDForDisplay));
+            unit.emplace_back();
+            continue;
+        }
+
+        Trace::Span instrument("Ledger::GetInstrument");
+        auto payment = ledger->GetInstrument(*owner, i);
+        if (!payment || !payment->SetTempValues()) {
+            otOut << "Error: cannot load payment at index: " << i << "\n";
+            clear();
+            return false;
+        }
+
+        int64_t paymentAmount = 0;
+        payment->GetAmount(paymentAmount);
+        amount.push_back(paymentAmount);
+        type.push_back(payment->GetTypeString());
+        senderNym.push_back(
+            displayId(*payment, &OTPayment::GetSenderNymIDForDisplay));
+        senderAccount.push_back(
+            displayId(*payment, &OTPayment::GetSenderAcctIDForDisplay));
+        recipientNym.push_back(
+            displayId(*payment, &OTPayment::GetRecipientNymID));
+        recipientAccount.push_back(
+            displayId(*payment, &OTPayment::GetRecipientAcctID));
+        unit.push_back(
+            displayId(*payment, &OTPayment::GetInstrumentDefinitionID));
+    }
+
+    return true;
+}
+
+const string& LedgerSnapshot::user(size_t index) const
+{
+    return senderNym[index].empty() ? recipientNym[index] : senderNym[index];
+}
+
+const string& LedgerSnapshot::account(size_t index) const
+{
+    return senderAccount[index].empty() ? recipientAccount[index]
+                                        : senderAccount[index];
+}
+
+void LedgerSnapshot::clear()
+{
+    total = 0;
+    position.clear();
+    date.clear();
+    number.clear();
+    reference.clear();
+    amount.clear();
+    type.clear();
+    senderNym.clear();
+    senderAccount.clear();
+    recipientNym.clear();
+    recipientAccount.clear();
+    unit.clear();
+}
+
+void LedgerSnapshot::reserve(size_t items)
+{
+    position.reserve(items);
+    date.reserve(items);
+    number.reserve(items);
+    reference.reserve(items);
+    amount.reserve(items);
+    type.reserve(items);
+    senderNym.reserve(items);
+    senderAccount.reserve(items);
+    recipientNym.reserve(items);
+    recipientAccount.reserve(items);
+    unit.reserve(items);
+}
@@ -0,0 +1,103 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_LEDGERSNAPSHOT_HPP__
+#define __OPENTXS_LEDGERSNAPSHOT_HPP__
+
+#include "Paging.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+// One box of receipts, deserialized once into columns. The SwigWrap
+// Ledger_* and Transaction_* calls take the serialized ledger or
+// transaction and parse it again on every call, so listing a box that way
+// costs receipts x fields x ledger size. A snapshot loads the ledger and
+// its box receipts a single time, and the listings read the columns.
+//
+// Only the receipts in the requested window are loaded: the window is
+// chosen from the dates of the abbreviated receipts in the box itself, so
+// listing the latest receipts costs the same however long the box is.
+class LedgerSnapshot
+{
+public:
+    enum class Box { Inbox, Outbox, RecordBox, ExpiredBox, PaymentInbox };
+
+    // account is ignored for the boxes that belong to a nym
+    bool load(
+        Box box,
+        const std::string& server,
+        const std::string& nym,
+        const std::string& account,
+        const Paging& paging = Paging());
+
+    // the receipts in the window, in listing order
+    size_t size() const { return number.size(); }
+    // all receipts in the box
+    size_t total = 0;
+
+    // the sender, or the recipient when there is no sender
+    const std::string& user(size_t index) const;
+    const std::string& account(size_t index) const;
+
+    // the index of each receipt in the box, for the commands that take one
+    std::vector<size_t> position;
+    std::vector<int64_t> date;
+    std::vector<int64_t> number;
+    std::vector<int64_t> reference;
+    std::vector<int64_t> amount;
+    std::vector<std::string> type;
+    std::vector<std::string> senderNym;
+    std::vector<std::string> senderAccount;
+    std::vector<std::string> recipientNym;
+    std::vector<std::string> recipientAccount;
+    // the instrument definition of each payment, only for the payment
+    // inbox, whose columns describe the payment instead of its receipt
+    std::vector<std::string> unit;
+
+private:
+    void clear();
+    void reserve(size_t items);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_LEDGERSNAPSHOT_HPP__
@@ -0,0 +1,118 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "LineTokenizer.hpp"
+
+#include <ctype.h>
+#include <stddef.h>
+#include <string.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+LineTokenizer::LineTokenizer() {}
+
+void LineTokenizer::add(char* start, char* end)
+{
+    *end = '\0';
+    argv_.push_back(start);
+    args_.emplace_back(start, end - start);
+}
+
+void LineTokenizer::tokenize(const char* argv0, const string& line)
+{
+    argv_.clear();
+    args_.clear();
+
+    // every argument is at most as long as its source text plus the
+    // terminating zero, so this is the only place the buffer can grow
+    size_t argv0Length = strlen(argv0);
+    size_t needed = argv0Length + 1 + line.length() + 1;
+    if (buffer_.size() < needed) { buffer_.resize(needed); }
+
+    char* arg = buffer_.data();
+
+    // add original command name
+    memcpy(arg, argv0, argv0Length);
+    add(arg, arg + argv0Length);
+    arg += argv0Length + 1;
+
+    const char* cmd = line.data();
+    const size_t length = line.length();
+
+    // '!' indicates that we expect this command to fail
+    //     which is very useful for running a test script
+    expectFailure_ = 0 < length && '!' == cmd[0];
+
+    // start at actual command
+    size_t i = expectFailure_ ? 1 : 0;
+    while (i < length) {
+        // skip any whitespace
+        while (i < length && isspace(cmd[i])) { i++; }
+        if (i == length) {
+            // it was trailing whitespace; we're done
+            break;
+        }
+
+        // remember where we start this new argument in the buffer
+        char* start = arg;
+
+        // an unquoted argument ends at the next whitespace,
+        // a double quoted one at the next double quote
+        bool quoted = '"' == cmd[i];
+        if (quoted) { i++; }
+
+        // a backslash is copied like any other character
+        while (i < length &&
+               (quoted ? '"' != cmd[i] : !isspace(cmd[i]))) {
+            *arg++ = cmd[i++];
+        }
+
+        // end of argument reached, terminate and add to arguments array
+        add(start, arg);
+        arg++;
+
+        // skip terminating double quote or end of line
+        if (quoted) { i++; }
+    }
+
+    used_ = arg - buffer_.data();
+}
@@ -0,0 +1,90 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_LINETOKENIZER_HPP__
+#define __OPENTXS_LINETOKENIZER_HPP__
+
+#include <stddef.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opentxs
+{
+
+// Splits a script/REPL line into an argc/argv combo in a single pass.
+//
+// Whitespace separates args as usual.
+// To include whitespace in an arg surround the entire arg with double quotes
+// An unterminated double-quoted arg will auto-terminate at end of line
+// A backslash is an ordinary character: it is kept, and does not escape
+// the quote or whitespace after it. It only keeps a following $ from being
+// expanded as a macro, see MacroTable
+// A leading '!' indicates that the command is expected to fail
+//
+// The arguments are stored in one buffer that is reused from line to line,
+// so once it has grown to fit the longest line no more memory is allocated.
+// The pointers returned by argv() stay valid until the next tokenize().
+class LineTokenizer
+{
+public:
+    LineTokenizer();
+
+    void tokenize(const char* argv0, const std::string& line);
+
+    int argc() const { return static_cast<int>(argv_.size()); }
+    char** argv() { return argv_.data(); }
+    const std::vector<std::string_view>& args() const { return args_; }
+    // all arguments, each one followed by its terminating zero
+    std::string_view data() const
+    {
+        return std::string_view(buffer_.data(), used_);
+    }
+    bool expectFailure() const { return expectFailure_; }
+
+private:
+    std::vector<char> buffer_;
+    std::vector<char*> argv_;
+    std::vector<std::string_view> args_;
+    size_t used_{0};
+    bool expectFailure_{false};
+
+    void add(char* start, char* end);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_LINETOKENIZER_HPP__
@@ -0,0 +1,209 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "MacroTable.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <ctype.h>
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// limit to 100 expansions to avoid endless recusion loop
+const int MAX_EXPANSIONS = 100;
+
+// limit to 10000 characters to avoid crazy recursive expansions
+const size_t MAX_LENGTH = 10000;
+
+bool isNameChar(char c) { return isalnum(c) || c == '_'; }
+}  // namespace
+
+MacroTable::MacroTable() {}
+
+void MacroTable::define(const string& name, const string& value)
+{
+    Macro macro;
+
+    // expand whatever can be expanded right now; references to macros that
+    // are not defined yet are left alone and expanded when used
+    int expansions = 0;
+    scratch_.clear();
+    if (Expanded ==
+        expand(value.data(), value.length(), true, scratch_, expansions)) {
+        macro.value = scratch_;
+    } else {
+        // leave it to expand() on use to report the problem
+        macro.value = value;
+    }
+    macro.final = isFinal(macro.value);
+
+    macros_[name] = macro;
+}
+
+bool MacroTable::expand(const string& line, string& out)
+{
+    out.clear();
+
+    int expansions = 0;
+    switch (expand(line.data(), line.length(), false, out, expansions)) {
+        case Expanded:
+            return true;
+
+        case Unknown:
+            otOut << "\n\n***ERROR***\n"
+                     "Macro expansion failed.\n"
+                     "Unknown macro: "
+                  << failedName_
+                  << "\n"
+                     "Command was: "
+                  << line;
+            break;
+
+        case TooMany:
+            otOut << "\n\n***ERROR***\n"
+                     "Macro expansion failed.\n"
+                     "Too many expansions at macro: "
+                  << failedName_
+                  << "\n"
+                     "Command was: "
+                  << line;
+            break;
+
+        case TooLong:
+            otOut << "\n\n***ERROR***\n"
+                     "Macro expansion failed.\n"
+                     "Command length exceeded at macro: "
+                  << failedName_
+                  << "\n"
+                     "Macro value is: "
+                  << failedValue_
+                  << "\n"
+                     "Command was: "
+                  << line;
+            break;
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+MacroTable::Result MacroTable::expand(
+    const char* text,
+    size_t length,
+    bool keepUnknown,
+    string& out,
+    int& expansions)
+{
+    size_t i = 0;
+    while (i < length) {
+        // copy everything up to the next macro
+        size_t macro = i;
+        while (macro < length &&
+               ('$' != text[macro] || (0 < macro && '\\' == text[macro - 1]))) {
+            macro++;
+        }
+        out.append(text + i, macro - i);
+        if (macro == length) { break; }
+
+        // gather rest of macro name 'maximum munch'
+        size_t macroEnd = macro + 1;
+        while (macroEnd < length && isNameChar(text[macroEnd])) { macroEnd++; }
+        i = macroEnd;
+
+        // has this macro been defined?
+        name_.assign(text + macro, macroEnd - macro);
+        auto found = macros_.find(name_);
+        if (found == macros_.end()) {
+            if (keepUnknown) {
+                out += name_;
+                continue;
+            }
+            failedName_ = name_;
+            return Unknown;
+        }
+
+        const Macro& value = found->second;
+
+        expansions++;
+        if (expansions > MAX_EXPANSIONS) {
+            failedName_ = name_;
+            return TooMany;
+        }
+
+        if (out.length() + value.value.length() + (length - i) > MAX_LENGTH) {
+            failedName_ = name_;
+            failedValue_ = value.value;
+            return TooLong;
+        }
+
+        if (value.final) {
+            out += value.value;
+            continue;
+        }
+
+        // the value still refers to other macros, expand it in place;
+        // a macro referring to itself ends up exceeding MAX_EXPANSIONS
+        Result result = expand(
+            value.value.data(),
+            value.value.length(),
+            keepUnknown,
+            out,
+            expansions);
+        if (Expanded != result) { return result; }
+    }
+
+    return Expanded;
+}
+
+bool MacroTable::isFinal(const string& value)
+{
+    for (size_t i = 0; i < value.length(); i++) {
+        if ('$' == value[i] && (0 == i || '\\' != value[i - 1])) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,91 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_MACROTABLE_HPP__
+#define __OPENTXS_MACROTABLE_HPP__
+
+#include <stddef.h>
+#include <string>
+#include <unordered_map>
+
+namespace opentxs
+{
+
+// The $macro definitions of a script/REPL session.
+//
+// Since a macro value stays valid for the entire lifetime of the command
+// loop, values are expanded once when they are defined. Expanding a line
+// is then a single pass that copies the line into the output buffer and
+// splices in the stored values. Only a value that refers to a macro which
+// was not defined yet at the time is expanded again when it is used.
+class MacroTable
+{
+public:
+    MacroTable();
+
+    void define(const std::string& name, const std::string& value);
+
+    // replaces every macro in line, reporting unknown, recursive and
+    // oversize macros; out is not usable when this returns false
+    bool expand(const std::string& line, std::string& out);
+
+private:
+    enum Result { Expanded, Unknown, TooMany, TooLong };
+
+    struct Macro {
+        std::string value;
+        // true when value contains no macros that still need expanding
+        bool final{false};
+    };
+
+    std::unordered_map<std::string, Macro> macros_;
+    std::string name_;
+    std::string scratch_;
+    std::string failedName_;
+    std::string failedValue_;
+
+    Result expand(
+        const char* text,
+        size_t length,
+        bool keepUnknown,
+        std::string& out,
+        int& expansions);
+    static bool isFinal(const std::string& value);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_MACROTABLE_HPP__
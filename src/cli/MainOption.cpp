@@ -0,0 +1,91 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "MainOption.hpp"
+
+#include <string.h>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+const char* const opentxs::GLOBAL_FLAGS[] = {"echocommand",
+                                             "echoexpand",
+                                             "errorlist",
+                                             "noprompt",
+                                             "dummy-passphrase",
+                                             "test",
+                                             "daemon",
+                                             nullptr};
+const char* const opentxs::GLOBAL_OPTIONS[] = {"socket",
+                                               "script",
+                                               "compile",
+                                               "output",
+                                               "workers",
+                                               "format",
+                                               "input-file",
+                                               "input",
+                                               nullptr};
+const char* const opentxs::MAIN_OPTIONS[] =
+    {"completion-index", "profile-startup", "stats", "trace", nullptr};
+
+bool opentxs::takeMainOption(
+    int& argc,
+    char* argv[],
+    const char* name,
+    string& value)
+{
+    string option = string("--") + name;
+    size_t length = option.length();
+    bool found = false;
+
+    int kept = 1;
+    for (int i = 1; i < argc; i++) {
+        if (0 == strncmp(argv[i], option.c_str(), length) &&
+            ('\0' == argv[i][length] || '=' == argv[i][length])) {
+            found = true;
+            if ('=' == argv[i][length]) { value = argv[i] + length + 1; }
+            continue;
+        }
+        argv[kept++] = argv[i];
+    }
+    argc = kept;
+    argv[argc] = nullptr;
+
+    return found;
+}
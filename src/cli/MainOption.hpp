@@ -0,0 +1,68 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_MAINOPTION_HPP__
+#define __OPENTXS_MAINOPTION_HPP__
+
+#include <string>
+
+namespace opentxs
+{
+
+// The options of an opentxs command line that are not arguments of a
+// command, for Opentxs::loadOptions() and the completion index. Each list
+// ends with nullptr.
+//
+// flags, which take no value
+extern const char* const GLOBAL_FLAGS[];
+// options that take a value
+extern const char* const GLOBAL_OPTIONS[];
+// the options main() takes out of argv with takeMainOption(), given as
+// --name or --name=value
+extern const char* const MAIN_OPTIONS[];
+
+// Removes every --name and --name=value from argv, for the options main()
+// handles before the command line reaches AnyOption. Returns whether the
+// option was given; value is set to the last value given with it.
+bool takeMainOption(
+    int& argc,
+    char* argv[],
+    const char* name,
+    std::string& value);
+}  // namespace opentxs
+#endif  // __OPENTXS_MAINOPTION_HPP__
@@ -0,0 +1,133 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "OptionsFile.hpp"
+
+#include <anyoption/anyoption.hpp>
+#include <opentxs/opentxs.hpp>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// options that will be checked only from the CLI option file
+const char* fileOptions[] = {"defaultserver",
+                             "defaultmyacct",
+                             "defaultmynym",
+                             "defaultmypurse",
+                             "defaulthisacct",
+                             "defaulthisnym",
+                             "defaulthispurse",
+                             "defaultformat",
+                             nullptr};
+}  // namespace
+
+OptionsFile::OptionsFile()
+    : table_(new Table)
+{
+    String configPath(OTPaths::AppDataFolder());
+    bool configPathFound = configPath.Exists() && 3 < configPath.GetLength();
+    OT_ASSERT_MSG(
+        configPathFound,
+        "RegisterAPIWithScript: Must set Config Path first!\n");
+    otWarn << "Using configuration path: " << configPath << "\n";
+
+    String optionsFile("command-line-ot.opt"), iniFileExact;
+    bool buildFullPathSuccess =
+        OTPaths::RelativeToCanonical(iniFileExact, configPath, optionsFile);
+    OT_ASSERT_MSG(buildFullPathSuccess, "Unable to set Full Path");
+
+    path_ = iniFileExact.Get();
+}
+
+const char* OptionsFile::get(const string& name)
+{
+    refresh();
+
+    auto found = table_->find(name);
+    if (found == table_->end()) { return nullptr; }
+    return found->second.c_str();
+}
+
+shared_ptr<const OptionsFile::Table> OptionsFile::table()
+{
+    refresh();
+    return table_;
+}
+
+void OptionsFile::refresh()
+{
+    struct stat info;
+    bool exists = 0 == stat(path_.c_str(), &info);
+    time_t modified = exists ? info.st_mtime : 0;
+    long long size = exists ? info.st_size : 0;
+
+    if (exists == exists_ && modified == modified_ && size == size_) {
+        return;
+    }
+
+    exists_ = exists;
+    modified_ = modified;
+    size_ = size;
+
+    shared_ptr<Table> table(new Table);
+    if (exists) {
+        otWarn << "Loading options file: " << path_ << "\n";
+
+        AnyOption opt;
+        for (int i = 0; nullptr != fileOptions[i]; i++) {
+            opt.setFileOption(fileOptions[i]);
+        }
+        opt.processFile(path_.c_str());
+
+        for (int i = 0; nullptr != fileOptions[i]; i++) {
+            const char* value = opt.getValue(fileOptions[i]);
+            if (nullptr != value) { (*table)[fileOptions[i]] = value; }
+        }
+    }
+
+    // readers holding the previous table keep using it unchanged
+    table_ = table;
+}
@@ -0,0 +1,76 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_OPTIONSFILE_HPP__
+#define __OPENTXS_OPTIONSFILE_HPP__
+
+#include <time.h>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace opentxs
+{
+
+// The default values from command-line-ot.opt (defaultserver, defaultmynym,
+// etc.). The file is parsed once into an immutable table, and parsed again
+// only when its modification time or size changes. Command line options
+// are looked up first and this table only fills in what they leave out.
+class OptionsFile
+{
+public:
+    typedef std::map<std::string, std::string> Table;
+
+    OptionsFile();
+
+    // returns nullptr when the file does not set the option; the value stays
+    // valid until the next lookup
+    const char* get(const std::string& name);
+    std::shared_ptr<const Table> table();
+
+private:
+    std::string path_;
+    bool exists_{false};
+    time_t modified_{0};
+    long long size_{0};
+    std::shared_ptr<const Table> table_;
+
+    void refresh();
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_OPTIONSFILE_HPP__
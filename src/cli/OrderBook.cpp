@@ -0,0 +1,158 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "OrderBook.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <charconv>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+bool toInt64(const string& text, int64_t& value)
+{
+    const char* end = text.data() + text.size();
+    auto result = from_chars(text.data(), end, value);
+    return errc() == result.ec && end == result.ptr;
+}
+
+// BidData and AskData have the same fields, but no common base
+template <typename Get>
+bool readSide(
+    const char* name,
+    int32_t count,
+    const Get& get,
+    vector<OrderBook::Offer>& side)
+{
+    side.reserve(count);
+    for (int32_t i = 0; i < count; i++) {
+        auto data = get(i);
+        if (nullptr == data) {
+            otOut << "Error: cannot load " << name << " data at index: " << i
+                  << "\n";
+            return false;
+        }
+
+        OrderBook::Offer offer;
+        if (!toInt64(data->price_per_scale, offer.price) ||
+            !toInt64(data->available_assets, offer.quantity) ||
+            !toInt64(data->transaction_id, offer.transaction)) {
+            otOut << "Error: invalid " << name << " data at index: " << i
+                  << "\n";
+            return false;
+        }
+        side.push_back(offer);
+    }
+    return true;
+}
+}  // namespace
+
+bool OrderBook::load(OTDB::OfferListMarket& offerList)
+{
+    bids_.clear();
+    asks_.clear();
+
+    bool loaded =
+        readSide(
+            "bid",
+            offerList.GetBidDataCount(),
+            [&](int32_t i) { return offerList.GetBidData(i); },
+            bids_) &&
+        readSide(
+            "ask",
+            offerList.GetAskDataCount(),
+            [&](int32_t i) { return offerList.GetAskData(i); },
+            asks_);
+    if (!loaded) {
+        bids_.clear();
+        asks_.clear();
+        return false;
+    }
+
+    sort();
+    return true;
+}
+
+void OrderBook::add(Side side, const Offer& offer)
+{
+    (Side::Bid == side ? bids_ : asks_).push_back(offer);
+}
+
+void OrderBook::sort()
+{
+    std::sort(bids_.begin(), bids_.end(), [](const Offer& a, const Offer& b) {
+        return a.price != b.price ? a.price > b.price
+                                  : a.transaction < b.transaction;
+    });
+    std::sort(asks_.begin(), asks_.end(), [](const Offer& a, const Offer& b) {
+        return a.price != b.price ? a.price < b.price
+                                  : a.transaction < b.transaction;
+    });
+}
+
+const vector<OrderBook::Offer>& OrderBook::offers(Side side) const
+{
+    return Side::Bid == side ? bids_ : asks_;
+}
+
+vector<OrderBook::Level> OrderBook::levels(Side side, size_t count) const
+{
+    vector<Level> levels;
+    int64_t cumulative = 0;
+    for (const auto& offer : offers(side)) {
+        if (levels.empty() || levels.back().price != offer.price) {
+            if (0 != count && levels.size() == count) { break; }
+            levels.push_back(Level{offer.price, 0, cumulative, 0});
+        }
+
+        Level& level = levels.back();
+        level.quantity += offer.quantity;
+        level.offers++;
+        cumulative += offer.quantity;
+        level.cumulative = cumulative;
+    }
+    return levels;
+}
@@ -0,0 +1,98 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_ORDERBOOK_HPP__
+#define __OPENTXS_ORDERBOOK_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace opentxs
+{
+
+namespace OTDB
+{
+class OfferListMarket;
+}
+
+// The offers of one market with integer prices and quantities, parsed once
+// from the strings of the OTDB offer list. Each side is kept in one array
+// sorted best first: bids by descending price, asks by ascending price,
+// and offers at the same price by transaction number.
+class OrderBook
+{
+public:
+    enum class Side { Bid, Ask };
+
+    struct Offer {
+        int64_t price;
+        int64_t quantity;
+        int64_t transaction;
+    };
+
+    // all offers at one price, with the quantity of this and all better
+    // levels in cumulative
+    struct Level {
+        int64_t price;
+        int64_t quantity;
+        int64_t cumulative;
+        int32_t offers;
+    };
+
+    // replaces the book; false when an offer is missing or not numeric
+    bool load(OTDB::OfferListMarket& offerList);
+
+    void add(Side side, const Offer& offer);
+    void sort();
+
+    bool empty() const { return bids_.empty() && asks_.empty(); }
+    const std::vector<Offer>& offers(Side side) const;
+    // the best "count" price levels of a side, or all of them for 0
+    std::vector<Level> levels(Side side, size_t count = 0) const;
+
+    // only meaningful when that side, or for spread() both, has offers
+    int64_t best(Side side) const { return offers(side).front().price; }
+    int64_t spread() const { return best(Side::Ask) - best(Side::Bid); }
+
+private:
+    std::vector<Offer> bids_;
+    std::vector<Offer> asks_;
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_ORDERBOOK_HPP__
@@ -0,0 +1,150 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "OutputCapture.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <iostream>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// the current thread's targets, by Stream
+enum Stream { Output = 0, Log = 1 };
+thread_local string* captured[2] = {nullptr, nullptr};
+
+// Installed as the buffer of std::cout and of the log streams. Sends every
+// write either to the capturing thread's string or to the original buffer.
+class ThreadBuffer : public streambuf
+{
+public:
+    ThreadBuffer(streambuf* original, Stream stream)
+        : original_(original)
+        , stream_(stream)
+    {
+    }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (traits_type::eq_int_type(c, traits_type::eof())) {
+            return traits_type::not_eof(c);
+        }
+
+        char ch = traits_type::to_char_type(c);
+        if (nullptr != captured[stream_]) {
+            captured[stream_]->append(1, ch);
+            return c;
+        }
+
+        lock_guard<mutex> lock(lock_);
+        return original_->sputc(ch);
+    }
+
+    streamsize xsputn(const char* s, streamsize n) override
+    {
+        if (nullptr != captured[stream_]) {
+            captured[stream_]->append(s, n);
+            return n;
+        }
+
+        lock_guard<mutex> lock(lock_);
+        return original_->sputn(s, n);
+    }
+
+    int sync() override
+    {
+        if (nullptr != captured[stream_]) { return 0; }
+
+        lock_guard<mutex> lock(lock_);
+        return original_->pubsync();
+    }
+
+private:
+    streambuf* original_;
+    Stream stream_;
+    mutex lock_;
+};
+
+// the log levels a command can make visible
+ostream* logStreams[] = {&otErr, &otOut, &otWarn, &otInfo};
+
+void install()
+{
+    static once_flag installed;
+    call_once(installed, []() {
+        // never deleted: the streams may still be written to during
+        // shutdown
+        cout.rdbuf(new ThreadBuffer(cout.rdbuf(), Output));
+        for (ostream* log : logStreams) {
+            log->rdbuf(new ThreadBuffer(log->rdbuf(), Log));
+        }
+    });
+}
+
+void flush()
+{
+    cout.flush();
+    for (ostream* log : logStreams) { log->flush(); }
+}
+}  // namespace
+
+OutputCapture::OutputCapture(string& target, string* log)
+    : previous_(captured[Output])
+    , previousLog_(captured[Log])
+{
+    install();
+    flush();
+    captured[Output] = &target;
+    // otherwise log messages keep going wherever they went before
+    if (nullptr != log) { captured[Log] = log; }
+}
+
+OutputCapture::~OutputCapture()
+{
+    flush();
+    captured[Output] = previous_;
+    captured[Log] = previousLog_;
+}
@@ -0,0 +1,67 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_OUTPUTCAPTURE_HPP__
+#define __OPENTXS_OUTPUTCAPTURE_HPP__
+
+#include <string>
+
+namespace opentxs
+{
+
+// While an OutputCapture exists, everything the current thread writes to
+// std::cout is appended to target instead of reaching the terminal. Other
+// threads keep writing straight through, so commands running side by side
+// each collect their own output. Given a log string, the log streams (otOut,
+// otErr, otWarn, otInfo) are collected the same way; otherwise log messages
+// still go straight to stderr.
+class OutputCapture
+{
+public:
+    explicit OutputCapture(std::string& target, std::string* log = nullptr);
+    ~OutputCapture();
+
+    OutputCapture(const OutputCapture&) = delete;
+    OutputCapture& operator=(const OutputCapture&) = delete;
+
+private:
+    std::string* previous_;
+    std::string* previousLog_;
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_OUTPUTCAPTURE_HPP__
@@ -0,0 +1,172 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Paging.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <charconv>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// reads exactly count digits at text[pos]
+bool digits(const string& text, size_t pos, size_t count, int& value)
+{
+    if (text.size() < pos + count) { return false; }
+    const char* begin = text.data() + pos;
+    auto result = from_chars(begin, begin + count, value);
+    return errc() == result.ec && begin + count == result.ptr;
+}
+
+bool parseDate(const string& text, int64_t& time)
+{
+    // YYYY-MM-DD, optionally followed by THH:MM or THH:MM:SS
+    const size_t size = text.size();
+    if (10 != size && 16 != size && 19 != size) { return false; }
+
+    tm parts{};
+    if (!digits(text, 0, 4, parts.tm_year) || '-' != text[4] ||
+        !digits(text, 5, 2, parts.tm_mon) || '-' != text[7] ||
+        !digits(text, 8, 2, parts.tm_mday)) {
+        return false;
+    }
+
+    if (10 < size) {
+        if (('T' != text[10] && ' ' != text[10]) ||
+            !digits(text, 11, 2, parts.tm_hour) || ':' != text[13] ||
+            !digits(text, 14, 2, parts.tm_min)) {
+            return false;
+        }
+        if (19 == size &&
+            (':' != text[16] || !digits(text, 17, 2, parts.tm_sec))) {
+            return false;
+        }
+    }
+
+    if (1 > parts.tm_mon || 12 < parts.tm_mon || 1 > parts.tm_mday ||
+        31 < parts.tm_mday || 23 < parts.tm_hour || 59 < parts.tm_min ||
+        59 < parts.tm_sec) {
+        return false;
+    }
+
+    parts.tm_year -= 1900;
+    parts.tm_mon -= 1;
+#ifdef _WIN32
+    time = _mkgmtime(&parts);
+#else
+    time = timegm(&parts);
+#endif
+    return true;
+}
+}  // namespace
+
+size_t Paging::span() const
+{
+    return SIZE_MAX - offset < limit ? SIZE_MAX : offset + limit;
+}
+
+vector<size_t> Paging::select(const vector<int64_t>& dates) const
+{
+    vector<size_t> positions;
+    if (0 == limit) { return positions; }
+
+    for (size_t i = 0; i < dates.size(); i++) {
+        if (inRange(dates[i])) { positions.push_back(i); }
+    }
+
+    // storage order need not be chronological; entries with equal dates
+    // keep their storage order, so the same box always pages the same way
+    stable_sort(
+        positions.begin(), positions.end(), [&dates](size_t a, size_t b) {
+            return dates[a] < dates[b];
+        });
+    if (newestFirst) { reverse(positions.begin(), positions.end()); }
+
+    positions.erase(
+        positions.begin(),
+        positions.begin() + min(offset, positions.size()));
+    if (limit < positions.size()) { positions.resize(limit); }
+
+    return positions;
+}
+
+bool Paging::parseTime(const string& text, int64_t& time)
+{
+    if (text.empty()) { return false; }
+
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+    int64_t value = 0;
+    auto result = from_chars(begin, end, value);
+    if (errc() != result.ec || 0 > value) { return false; }
+
+    if (end == result.ptr) {
+        time = value;
+        return true;
+    }
+
+    if (end == result.ptr + 1) {
+        int64_t unit = 0;
+        switch (*result.ptr) {
+            case 'm':
+                unit = 60;
+                break;
+            case 'h':
+                unit = 60 * 60;
+                break;
+            case 'd':
+                unit = 24 * 60 * 60;
+                break;
+            default:
+                return false;
+        }
+        const int64_t now = std::time(nullptr);
+        if (value > now / unit) { return false; }
+        time = now - value * unit;
+        return true;
+    }
+
+    return parseDate(text, time);
+}
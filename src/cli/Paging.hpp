@@ -0,0 +1,78 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_PAGING_HPP__
+#define __OPENTXS_PAGING_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+// The window of a box or thread listing chosen with --offset, --limit,
+// --since, --until and --reverse. Times are seconds since the epoch; since
+// is inclusive and until exclusive. The default window lists everything,
+// oldest first.
+class Paging
+{
+public:
+    size_t offset = 0;
+    size_t limit = SIZE_MAX;
+    int64_t since = INT64_MIN;
+    int64_t until = INT64_MAX;
+    bool newestFirst = false;
+
+    bool inRange(int64_t date) const { return since <= date && date < until; }
+    // the number of entries a listing has to hold on to
+    size_t span() const;
+
+    // The positions of the entries to list, in listing order, given the
+    // dates of all entries in storage order. Entries are ordered by date,
+    // ties by position. Only the dates are looked at, so the entries
+    // themselves can be loaded afterwards.
+    std::vector<size_t> select(const std::vector<int64_t>& dates) const;
+
+    // "1510000000", "2017-11-06", "2017-11-06T20:30" or
+    // "2017-11-06T20:30:15" (UTC), or an age like "90m", "12h" or "7d"
+    static bool parseTime(const std::string& text, int64_t& time);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_PAGING_HPP__
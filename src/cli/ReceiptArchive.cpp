@@ -0,0 +1,593 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "ReceiptArchive.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+const uint32_t MAGIC = 0x4152544f;  // "OTRA"
+const uint32_t VERSION = 1;
+const uint32_t NONE = UINT32_MAX;
+
+// the string columns of a segment
+enum Column {
+    SERVER,
+    NYM,
+    ACCOUNT,
+    TYPE,
+    COUNTERPARTY_NYM,
+    COUNTERPARTY_ACCOUNT,
+    UNIT,
+    COLUMNS
+};
+
+// the permutations of the rows of a segment
+enum Index {
+    BY_NUMBER,
+    BY_AMOUNT,
+    BY_COUNTERPARTY_NYM,
+    BY_COUNTERPARTY_ACCOUNT,
+    INDEXES
+};
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rows;
+    uint32_t strings;
+    // bytes of the segment after the header, a multiple of 8
+    uint64_t size;
+    int64_t minDate;
+    int64_t maxDate;
+    int64_t minAmount;
+    int64_t maxAmount;
+    int64_t minNumber;
+    int64_t maxNumber;
+};
+
+// Where each array of a segment starts, in bytes after the header. The
+// 64-bit columns come first, so that a segment read into an int64_t buffer
+// has every array aligned. The characters of the string table are last.
+struct Layout {
+    Layout(uint64_t rows, uint64_t strings)
+        : date(0)
+        , number(date + 8 * rows)
+        , reference(number + 8 * rows)
+        , amount(reference + 8 * rows)
+        , offsets(amount + 8 * rows)
+        , columns(offsets + 4 * (strings + 1))
+        , indexes(columns + 4 * rows * COLUMNS)
+        , box(indexes + 4 * rows * INDEXES)
+        , chars(box + rows)
+    {
+    }
+
+    uint64_t date;
+    uint64_t number;
+    uint64_t reference;
+    uint64_t amount;
+    uint64_t offsets;
+    uint64_t columns;
+    uint64_t indexes;
+    uint64_t box;
+    uint64_t chars;
+};
+
+const string& field(const ReceiptArchive::Row& row, int column)
+{
+    switch (column) {
+        case SERVER:
+            return row.server;
+        case NYM:
+            return row.nym;
+        case ACCOUNT:
+            return row.account;
+        case TYPE:
+            return row.type;
+        case COUNTERPARTY_NYM:
+            return row.counterpartyNym;
+        case COUNTERPARTY_ACCOUNT:
+            return row.counterpartyAccount;
+        default:
+            return row.unit;
+    }
+}
+
+bool readAt(int fd, void* data, uint64_t size, uint64_t offset)
+{
+    char* buf = static_cast<char*>(data);
+    while (0 < size) {
+        ssize_t got = pread(fd, buf, size, offset);
+        if (0 > got && EINTR == errno) { continue; }
+        if (0 >= got) { return false; }
+        buf += got;
+        size -= got;
+        offset += got;
+    }
+    return true;
+}
+
+bool writeAt(int fd, const void* data, uint64_t size, uint64_t offset)
+{
+    const char* buf = static_cast<const char*>(data);
+    while (0 < size) {
+        ssize_t put = pwrite(fd, buf, size, offset);
+        if (0 > put && EINTR == errno) { continue; }
+        if (0 >= put) { return false; }
+        buf += put;
+        size -= put;
+        offset += put;
+    }
+    return true;
+}
+
+// Calls visit(offset, header) for each complete segment, with the offset
+// of the segment after its header. Returns where the complete segments
+// end, or -1 when the file cannot be read or visit returns false.
+template <typename Visit>
+int64_t scan(int fd, const Visit& visit)
+{
+    struct stat info;
+    if (0 != fstat(fd, &info)) { return -1; }
+    const uint64_t fileSize = info.st_size;
+
+    uint64_t offset = 0;
+    while (sizeof(Header) <= fileSize - offset) {
+        Header header;
+        if (!readAt(fd, &header, sizeof(header), offset)) { return -1; }
+
+        const uint64_t available = fileSize - offset - sizeof(header);
+        if (MAGIC != header.magic || VERSION != header.version ||
+            0 != header.size % 8 || available < header.size ||
+            Layout(header.rows, header.strings).chars > header.size) {
+            break;
+        }
+
+        if (!visit(offset + sizeof(header), header)) { return -1; }
+        offset += sizeof(header) + header.size;
+    }
+
+    return offset;
+}
+
+// the rows at index[first, last) whose key is in [low, high], for an index
+// sorted by that key
+template <typename Key>
+pair<const uint32_t*, const uint32_t*> range(
+    const uint32_t* index,
+    uint32_t rows,
+    const Key& key,
+    int64_t low,
+    int64_t high)
+{
+    const uint32_t* first = partition_point(
+        index, index + rows, [&](uint32_t row) { return key(row) < low; });
+    const uint32_t* last = partition_point(
+        first, index + rows, [&](uint32_t row) { return key(row) <= high; });
+    return {first, last};
+}
+
+// One segment read into memory, with its arrays pointing into the buffer.
+class Segment
+{
+public:
+    bool read(int fd, uint64_t offset, const Header& header);
+    void match(
+        const ReceiptArchive::Query& query,
+        const Paging& paging,
+        vector<ReceiptArchive::Row>& matches) const;
+
+private:
+    vector<int64_t> buffer_;
+    uint32_t rows_ = 0;
+    uint32_t strings_ = 0;
+    const int64_t* date_ = nullptr;
+    const int64_t* number_ = nullptr;
+    const int64_t* reference_ = nullptr;
+    const int64_t* amount_ = nullptr;
+    const uint32_t* offsets_ = nullptr;
+    const uint32_t* columns_[COLUMNS] = {};
+    const uint32_t* indexes_[INDEXES] = {};
+    const uint8_t* box_ = nullptr;
+    const char* chars_ = nullptr;
+
+    string_view text(uint32_t id) const
+    {
+        return string_view(
+            chars_ + offsets_[id], offsets_[id + 1] - offsets_[id]);
+    }
+    // the string table is sorted; NONE when the text is not in it
+    uint32_t find(const string& text) const;
+    ReceiptArchive::Row row(uint32_t row) const;
+};
+
+bool Segment::read(int fd, uint64_t offset, const Header& header)
+{
+    buffer_.resize(header.size / 8);
+    if (!readAt(fd, buffer_.data(), header.size, offset)) { return false; }
+
+    const Layout layout(header.rows, header.strings);
+    const char* base = reinterpret_cast<const char*>(buffer_.data());
+    rows_ = header.rows;
+    strings_ = header.strings;
+    date_ = reinterpret_cast<const int64_t*>(base + layout.date);
+    number_ = reinterpret_cast<const int64_t*>(base + layout.number);
+    reference_ = reinterpret_cast<const int64_t*>(base + layout.reference);
+    amount_ = reinterpret_cast<const int64_t*>(base + layout.amount);
+    offsets_ = reinterpret_cast<const uint32_t*>(base + layout.offsets);
+    for (int i = 0; i < COLUMNS; i++) {
+        columns_[i] = reinterpret_cast<const uint32_t*>(
+                          base + layout.columns) +
+                      uint64_t(i) * rows_;
+    }
+    for (int i = 0; i < INDEXES; i++) {
+        indexes_[i] = reinterpret_cast<const uint32_t*>(
+                          base + layout.indexes) +
+                      uint64_t(i) * rows_;
+    }
+    box_ = reinterpret_cast<const uint8_t*>(base + layout.box);
+    chars_ = base + layout.chars;
+
+    // a damaged segment must not make a query read outside of it
+    const uint64_t chars = header.size - layout.chars;
+    for (uint32_t i = 0; i < strings_; i++) {
+        if (offsets_[i] > offsets_[i + 1]) { return false; }
+    }
+    if (0 != offsets_[0] || chars < offsets_[strings_]) { return false; }
+    for (int i = 0; i < COLUMNS; i++) {
+        for (uint32_t row = 0; row < rows_; row++) {
+            if (strings_ <= columns_[i][row]) { return false; }
+        }
+    }
+    for (int i = 0; i < INDEXES; i++) {
+        for (uint32_t row = 0; row < rows_; row++) {
+            if (rows_ <= indexes_[i][row]) { return false; }
+        }
+    }
+
+    return true;
+}
+
+void Segment::match(
+    const ReceiptArchive::Query& query,
+    const Paging& paging,
+    vector<ReceiptArchive::Row>& matches) const
+{
+    uint32_t counterparty = NONE;
+    if (!query.counterparty.empty()) {
+        counterparty = find(query.counterparty);
+        if (NONE == counterparty) { return; }
+    }
+
+    const uint32_t* counterpartyNym = columns_[COUNTERPARTY_NYM];
+    const uint32_t* counterpartyAccount = columns_[COUNTERPARTY_ACCOUNT];
+
+    auto keep = [&](uint32_t row) {
+        return paging.inRange(date_[row]) &&
+               query.minAmount <= amount_[row] &&
+               amount_[row] <= query.maxAmount &&
+               (0 == query.number || query.number == number_[row]) &&
+               (NONE == counterparty ||
+                counterparty == counterpartyNym[row] ||
+                counterparty == counterpartyAccount[row]);
+    };
+    auto add = [&](uint32_t row) {
+        if (keep(row)) { matches.push_back(this->row(row)); }
+    };
+    auto addAll = [&](pair<const uint32_t*, const uint32_t*> rows) {
+        for (const uint32_t* row = rows.first; row != rows.second; row++) {
+            add(*row);
+        }
+    };
+
+    // the most selective index narrows the rows, the others are checked
+    // row by row
+    if (0 != query.number) {
+        addAll(range(
+            indexes_[BY_NUMBER],
+            rows_,
+            [&](uint32_t row) { return number_[row]; },
+            query.number,
+            query.number));
+    } else if (NONE != counterparty) {
+        addAll(range(
+            indexes_[BY_COUNTERPARTY_NYM],
+            rows_,
+            [&](uint32_t row) { return counterpartyNym[row]; },
+            counterparty,
+            counterparty));
+        auto byAccount = range(
+            indexes_[BY_COUNTERPARTY_ACCOUNT],
+            rows_,
+            [&](uint32_t row) { return counterpartyAccount[row]; },
+            counterparty,
+            counterparty);
+        for (const uint32_t* row = byAccount.first; row != byAccount.second;
+             row++) {
+            // already added through the nym
+            if (counterparty != counterpartyNym[*row]) { add(*row); }
+        }
+    } else if (INT64_MIN != paging.since || INT64_MAX != paging.until) {
+        // the rows themselves are sorted by date
+        const uint32_t first =
+            lower_bound(date_, date_ + rows_, paging.since) - date_;
+        const uint32_t last =
+            lower_bound(date_, date_ + rows_, paging.until) - date_;
+        for (uint32_t row = first; row < last; row++) { add(row); }
+    } else if (INT64_MIN != query.minAmount || INT64_MAX != query.maxAmount) {
+        addAll(range(
+            indexes_[BY_AMOUNT],
+            rows_,
+            [&](uint32_t row) { return amount_[row]; },
+            query.minAmount,
+            query.maxAmount));
+    } else {
+        for (uint32_t row = 0; row < rows_; row++) { add(row); }
+    }
+}
+
+uint32_t Segment::find(const string& text) const
+{
+    uint32_t low = 0;
+    uint32_t high = strings_;
+    while (low < high) {
+        const uint32_t middle = low + (high - low) / 2;
+        if (this->text(middle) < text) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return (low < strings_ && this->text(low) == text) ? low : NONE;
+}
+
+ReceiptArchive::Row Segment::row(uint32_t row) const
+{
+    ReceiptArchive::Row result;
+    result.box = static_cast<ReceiptArchive::Box>(box_[row]);
+    result.date = date_[row];
+    result.number = number_[row];
+    result.reference = reference_[row];
+    result.amount = amount_[row];
+    result.server = text(columns_[SERVER][row]);
+    result.nym = text(columns_[NYM][row]);
+    result.account = text(columns_[ACCOUNT][row]);
+    result.type = text(columns_[TYPE][row]);
+    result.counterpartyNym = text(columns_[COUNTERPARTY_NYM][row]);
+    result.counterpartyAccount = text(columns_[COUNTERPARTY_ACCOUNT][row]);
+    result.unit = text(columns_[UNIT][row]);
+    return result;
+}
+
+bool byDate(const ReceiptArchive::Row& a, const ReceiptArchive::Row& b)
+{
+    return a.date < b.date || (a.date == b.date && a.number < b.number);
+}
+}  // namespace
+
+ReceiptArchive::ReceiptArchive(const string& path)
+    : path_(path)
+{
+}
+
+string ReceiptArchive::defaultPath()
+{
+    String configPath(OTPaths::AppDataFolder()), archiveFile;
+    bool buildFullPathSuccess = OTPaths::RelativeToCanonical(
+        archiveFile, configPath, String("receipts.archive"));
+    OT_ASSERT_MSG(buildFullPathSuccess, "Unable to set Full Path");
+    return archiveFile.Get();
+}
+
+bool ReceiptArchive::append(vector<Row> rows)
+{
+    if (rows.empty()) { return true; }
+    if (UINT32_MAX <= rows.size()) { return false; }
+    sort(rows.begin(), rows.end(), byDate);
+
+    vector<string_view> strings;
+    strings.reserve(rows.size() * COLUMNS);
+    for (const auto& row : rows) {
+        for (int i = 0; i < COLUMNS; i++) { strings.push_back(field(row, i)); }
+    }
+    sort(strings.begin(), strings.end());
+    strings.erase(unique(strings.begin(), strings.end()), strings.end());
+
+    uint64_t characters = 0;
+    for (const auto& text : strings) { characters += text.size(); }
+    if (UINT32_MAX <= characters) { return false; }
+
+    const uint32_t count = rows.size();
+    const Layout layout(count, strings.size());
+    const uint64_t size = (layout.chars + characters + 7) / 8 * 8;
+
+    vector<int64_t> buffer(size / 8, 0);
+    char* base = reinterpret_cast<char*>(buffer.data());
+    int64_t* date = reinterpret_cast<int64_t*>(base + layout.date);
+    int64_t* number = reinterpret_cast<int64_t*>(base + layout.number);
+    int64_t* reference = reinterpret_cast<int64_t*>(base + layout.reference);
+    int64_t* amount = reinterpret_cast<int64_t*>(base + layout.amount);
+    uint32_t* offsets = reinterpret_cast<uint32_t*>(base + layout.offsets);
+    uint32_t* columns = reinterpret_cast<uint32_t*>(base + layout.columns);
+    uint32_t* indexes = reinterpret_cast<uint32_t*>(base + layout.indexes);
+    uint8_t* box = reinterpret_cast<uint8_t*>(base + layout.box);
+    char* chars = base + layout.chars;
+
+    uint32_t offset = 0;
+    for (size_t i = 0; i < strings.size(); i++) {
+        offsets[i] = offset;
+        strings[i].copy(chars + offset, strings[i].size());
+        offset += strings[i].size();
+    }
+    offsets[strings.size()] = offset;
+
+    Header header{MAGIC,
+                  VERSION,
+                  count,
+                  static_cast<uint32_t>(strings.size()),
+                  size,
+                  INT64_MAX,
+                  INT64_MIN,
+                  INT64_MAX,
+                  INT64_MIN,
+                  INT64_MAX,
+                  INT64_MIN};
+
+    for (uint32_t row = 0; row < count; row++) {
+        const Row& receipt = rows[row];
+        date[row] = receipt.date;
+        number[row] = receipt.number;
+        reference[row] = receipt.reference;
+        amount[row] = receipt.amount;
+        box[row] = static_cast<uint8_t>(receipt.box);
+        for (int i = 0; i < COLUMNS; i++) {
+            const string& text = field(receipt, i);
+            columns[uint64_t(i) * count + row] =
+                lower_bound(strings.begin(), strings.end(), text) -
+                strings.begin();
+        }
+
+        header.minDate = min(header.minDate, receipt.date);
+        header.maxDate = max(header.maxDate, receipt.date);
+        header.minAmount = min(header.minAmount, receipt.amount);
+        header.maxAmount = max(header.maxAmount, receipt.amount);
+        header.minNumber = min(header.minNumber, receipt.number);
+        header.maxNumber = max(header.maxNumber, receipt.number);
+    }
+
+    // rows with the same key stay in date order
+    auto sortBy = [&](Index index, const auto& key) {
+        uint32_t* permutation = indexes + uint64_t(index) * count;
+        iota(permutation, permutation + count, 0);
+        stable_sort(
+            permutation, permutation + count, [&](uint32_t a, uint32_t b) {
+                return key(a) < key(b);
+            });
+    };
+    const uint32_t* counterpartyNym = columns + COUNTERPARTY_NYM * count;
+    const uint32_t* counterpartyAccount =
+        columns + COUNTERPARTY_ACCOUNT * count;
+    sortBy(BY_NUMBER, [&](uint32_t row) { return number[row]; });
+    sortBy(BY_AMOUNT, [&](uint32_t row) { return amount[row]; });
+    sortBy(BY_COUNTERPARTY_NYM, [&](uint32_t row) {
+        return counterpartyNym[row];
+    });
+    sortBy(BY_COUNTERPARTY_ACCOUNT, [&](uint32_t row) {
+        return counterpartyAccount[row];
+    });
+
+    int fd = open(path_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (0 > fd) { return false; }
+
+    // a segment cut short by an earlier crash is overwritten
+    bool success = 0 == flock(fd, LOCK_EX);
+    const int64_t end =
+        success ? scan(fd, [](uint64_t, const Header&) { return true; }) : -1;
+    success = 0 <= end && 0 == ftruncate(fd, end) &&
+              writeAt(fd, &header, sizeof(header), end) &&
+              writeAt(fd, buffer.data(), size, end + sizeof(header)) &&
+              0 == fsync(fd);
+
+    close(fd);
+    return success;
+}
+
+bool ReceiptArchive::query(
+    const Query& query,
+    const Paging& paging,
+    vector<Row>& matches) const
+{
+    matches.clear();
+
+    int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (0 > fd) {
+        // nothing has been archived yet
+        return ENOENT == errno;
+    }
+
+    Segment segment;
+    auto visit = [&](uint64_t offset, const Header& header) {
+        // skipped unread when the segment cannot hold a match
+        if (header.maxDate < paging.since || header.minDate >= paging.until ||
+            header.maxAmount < query.minAmount ||
+            header.minAmount > query.maxAmount ||
+            (0 != query.number && (query.number < header.minNumber ||
+                                   query.number > header.maxNumber))) {
+            return true;
+        }
+        if (!segment.read(fd, offset, header)) { return false; }
+        segment.match(query, paging, matches);
+        return true;
+    };
+    const int64_t end = 0 == flock(fd, LOCK_SH) ? scan(fd, visit) : -1;
+    close(fd);
+    if (0 > end) { return false; }
+
+    if (paging.newestFirst) {
+        sort(matches.begin(), matches.end(), [](const Row& a, const Row& b) {
+            return byDate(b, a);
+        });
+    } else {
+        sort(matches.begin(), matches.end(), byDate);
+    }
+
+    const size_t first = min(paging.offset, matches.size());
+    const size_t last = first + min(paging.limit, matches.size() - first);
+    matches.erase(matches.begin() + last, matches.end());
+    matches.erase(matches.begin(), matches.begin() + first);
+    return true;
+}
@@ -0,0 +1,115 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_RECEIPTARCHIVE_HPP__
+#define __OPENTXS_RECEIPTARCHIVE_HPP__
+
+#include "Paging.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+// Append-only local archive of record box and expired box receipts, for
+// queries over years of history without loading any ledger.
+//
+// The file is a sequence of segments, one per append, each written once
+// and never changed. A segment stores its receipts by column, sorted by
+// date: the integer columns as arrays, and the IDs and types as indices
+// into a sorted string table of the segment. Sorted permutations by
+// transaction number, amount, counterparty nym and counterparty account
+// are the secondary indexes. The header of each segment holds the range
+// of its dates, amounts and transaction numbers, so segments a query
+// cannot match are skipped without being read.
+//
+// The file is in host byte order; it belongs to the local wallet. A
+// segment cut short by a crash is ignored, and dropped by the next append.
+class ReceiptArchive
+{
+public:
+    enum class Box : uint8_t { NymRecords, AccountRecords, Expired };
+
+    struct Row {
+        Box box;
+        int64_t date;
+        int64_t number;
+        int64_t reference;
+        int64_t amount;
+        std::string server;
+        // the owner of the box; account is the nym for the nym's boxes
+        std::string nym;
+        std::string account;
+        std::string type;
+        std::string counterpartyNym;
+        std::string counterpartyAccount;
+        // the instrument definition of account records, "" otherwise
+        std::string unit;
+    };
+
+    struct Query {
+        // a nym or account ID on the other side, "" for any
+        std::string counterparty;
+        // 0 for any
+        int64_t number = 0;
+        int64_t minAmount = INT64_MIN;
+        int64_t maxAmount = INT64_MAX;
+    };
+
+    explicit ReceiptArchive(const std::string& path);
+
+    // the archive of the wallet, in the data folder
+    static std::string defaultPath();
+
+    // writes the rows as one new segment and syncs it to disk
+    bool append(std::vector<Row> rows);
+    // the matches, by date, within the since, until, offset, limit and
+    // order of paging; false when the archive cannot be read
+    bool query(
+        const Query& query,
+        const Paging& paging,
+        std::vector<Row>& matches) const;
+
+private:
+    std::string path_;
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_RECEIPTARCHIVE_HPP__
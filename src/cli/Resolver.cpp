@@ -0,0 +1,189 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Resolver.hpp"
+
+#include "Trace.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// (key, id) pairs sorted by key, where the key is either the id itself or
+// the name of the object
+typedef vector<pair<string, string>> Keys;
+
+struct Table {
+    bool loaded = false;
+    Keys ids;
+    Keys names;
+};
+
+const size_t KINDS = 4;
+
+// script workers resolve arguments in parallel
+mutex tablesLock;
+Table tables[KINDS];
+
+template <typename Id, typename Name>
+void addAll(Table& table, int32_t count, const Id& id, const Name& name)
+{
+    for (int32_t i = 0; i < count; i++) {
+        string value = id(i);
+        if (value.empty()) { continue; }
+        table.ids.emplace_back(value, value);
+        table.names.emplace_back(name(value), value);
+    }
+}
+
+void load(Resolver::Kind kind, Table& table)
+{
+    Trace::Span span("Resolver::load");
+    table.ids.clear();
+    table.names.clear();
+
+    switch (kind) {
+        case Resolver::Kind::Nym:
+            addAll(
+                table,
+                SwigWrap::GetNymCount(),
+                [](int32_t i) { return SwigWrap::GetNym_ID(i); },
+                [](const string& id) { return SwigWrap::GetNym_Name(id); });
+            break;
+        case Resolver::Kind::Account:
+            for (const auto& it : OT::App().DB().AccountList()) {
+                const string& id = std::get<0>(it);
+                table.ids.emplace_back(id, id);
+                table.names.emplace_back(
+                    SwigWrap::GetAccountWallet_Name(id), id);
+            }
+            break;
+        case Resolver::Kind::Server:
+            addAll(
+                table,
+                SwigWrap::GetServerCount(),
+                [](int32_t i) { return SwigWrap::GetServer_ID(i); },
+                [](const string& id) { return SwigWrap::GetServer_Name(id); });
+            break;
+        case Resolver::Kind::Unit:
+            addAll(
+                table,
+                SwigWrap::GetAssetTypeCount(),
+                [](int32_t i) { return SwigWrap::GetAssetType_ID(i); },
+                [](const string& id) {
+                    return SwigWrap::GetAssetType_Name(id);
+                });
+            break;
+    }
+
+    sort(table.ids.begin(), table.ids.end());
+    sort(table.names.begin(), table.names.end());
+    table.loaded = true;
+}
+
+// Found with the id of the only key that matches, Unknown when no key
+// matches and Ambiguous when more than one does. Every object has one key
+// in each table. An exact match only looks at keys equal to text, a
+// prefix match at keys starting with it.
+Resolver::Result find(
+    const Keys& keys,
+    const string& text,
+    bool exact,
+    string& id)
+{
+    auto first = lower_bound(
+        keys.begin(),
+        keys.end(),
+        text,
+        [](const pair<string, string>& key, const string& text) {
+            return key.first < text;
+        });
+
+    auto matches = [&](Keys::const_iterator it) {
+        if (keys.end() == it) { return false; }
+        return exact ? it->first == text
+                     : 0 == it->first.compare(0, text.length(), text);
+    };
+
+    if (!matches(first)) { return Resolver::Result::Unknown; }
+    if (matches(first + 1)) { return Resolver::Result::Ambiguous; }
+
+    id = first->second;
+    return Resolver::Result::Found;
+}
+}  // namespace
+
+Resolver::Result Resolver::resolve(Kind kind, const string& text, string& id)
+{
+    if (text.empty()) { return Result::Unknown; }
+
+    lock_guard<mutex> lock(tablesLock);
+
+    Table& table = tables[static_cast<size_t>(kind)];
+    if (!table.loaded) { load(kind, table); }
+
+    Result result = find(table.ids, text, true, id);
+    if (Result::Unknown != result) { return result; }
+    result = find(table.names, text, true, id);
+    if (Result::Unknown != result) { return result; }
+    result = find(table.ids, text, false, id);
+    if (Result::Unknown != result) { return result; }
+    return find(table.names, text, false, id);
+}
+
+void Resolver::invalidate()
+{
+    lock_guard<mutex> lock(tablesLock);
+    for (auto& table : tables) {
+        table.loaded = false;
+        table.ids.clear();
+        table.names.clear();
+    }
+}
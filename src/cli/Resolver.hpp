@@ -0,0 +1,65 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_RESOLVER_HPP__
+#define __OPENTXS_RESOLVER_HPP__
+
+#include <string>
+
+namespace opentxs
+{
+
+// Turns what the user typed for a nym, account, server or unit into its
+// full ID. Tried in order: the full ID, the full name, a unique ID prefix
+// and a unique name prefix. A prefix or a name shared by more than one
+// object is ambiguous rather than resolved to whichever comes first.
+//
+// The IDs and names of each kind are read from the wallet once per session
+// into sorted arrays, so a lookup is a binary search. invalidate() drops
+// them after a command that can add, remove or rename wallet objects.
+class Resolver
+{
+public:
+    enum class Kind { Nym, Account, Server, Unit };
+    enum class Result { Found, Unknown, Ambiguous };
+
+    static Result resolve(Kind kind, const std::string& text, std::string& id);
+    static void invalidate();
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_RESOLVER_HPP__
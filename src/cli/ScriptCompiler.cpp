@@ -0,0 +1,392 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "ScriptCompiler.hpp"
+
+#include "CmdRegistry.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+const char MAGIC[] = "OTCLISCRIPT";
+const size_t MAGIC_LENGTH = sizeof(MAGIC) - 1;
+
+// bump this whenever the layout written by CompiledScript::save() changes
+const uint32_t FORMAT_VERSION = 3;
+
+class Writer
+{
+public:
+    string data;
+
+    void u8(uint8_t value) { data.append(1, static_cast<char>(value)); }
+    void u32(uint32_t value) { raw(&value, sizeof(value)); }
+    void u64(uint64_t value) { raw(&value, sizeof(value)); }
+    void str(const string& value)
+    {
+        u32(value.length());
+        data += value;
+    }
+
+private:
+    void raw(const void* value, size_t size)
+    {
+        data.append(static_cast<const char*>(value), size);
+    }
+};
+
+class Reader
+{
+public:
+    Reader(const string& data)
+        : data_(data)
+    {
+    }
+
+    bool u8(uint8_t& value) { return raw(&value, sizeof(value)); }
+    bool u32(uint32_t& value) { return raw(&value, sizeof(value)); }
+    bool u64(uint64_t& value) { return raw(&value, sizeof(value)); }
+    bool str(string& value)
+    {
+        uint32_t length = 0;
+        if (!u32(length) || data_.length() - pos_ < length) { return false; }
+        value.assign(data_, pos_, length);
+        pos_ += length;
+        return true;
+    }
+    bool skip(size_t size)
+    {
+        if (data_.length() - pos_ < size) { return false; }
+        pos_ += size;
+        return true;
+    }
+
+private:
+    const string& data_;
+    size_t pos_{0};
+
+    bool raw(void* value, size_t size)
+    {
+        if (data_.length() - pos_ < size) { return false; }
+        memcpy(value, data_.data() + pos_, size);
+        pos_ += size;
+        return true;
+    }
+};
+
+bool validArgs(const string& args, uint32_t argc)
+{
+    if (!args.empty() && '\0' != args.back()) { return false; }
+    auto terminators = count(args.begin(), args.end(), '\0');
+    return argc == static_cast<size_t>(terminators);
+}
+
+string trimmed(const string& s)
+{
+    size_t begin = 0;
+    size_t end = s.length();
+    while (begin < end && isspace(s[begin])) { begin++; }
+    while (end > begin && isspace(s[end - 1])) { end--; }
+    return s.substr(begin, end - begin);
+}
+
+// a compiled script is only valid for the build and the command table
+// that produced it
+string fingerprint()
+{
+    return string(OPENTXS_CLI_VERSION_STRING) + "/" +
+           to_string(CmdRegistry::size());
+}
+
+// reads everything up to the line count; false unless the data was written
+// by this build
+bool readHeader(Reader& in, uint64_t& hash)
+{
+    uint32_t version = 0;
+    string built;
+    return in.skip(MAGIC_LENGTH) && in.u32(version) &&
+           FORMAT_VERSION == version && in.u64(hash) && in.str(built) &&
+           fingerprint() == built;
+}
+}  // namespace
+
+ScriptCompiler::ScriptCompiler(const CmdRegistry& registry, const char* argv0)
+    : registry_(registry)
+    , argv0_(argv0)
+{
+}
+
+void ScriptCompiler::compile(
+    int32_t lineNumber,
+    const string& input,
+    ScriptLine& line)
+{
+    line.lineNumber = lineNumber;
+    line.text = trimmed(input);
+    line.kind = ScriptLine::Echo;
+    line.expectFailure = false;
+    line.background = false;
+    line.command = -1;
+    line.argc = 0;
+    line.expanded.clear();
+    line.args.clear();
+
+    const string& cmd = line.text;
+
+    // empty lines and lines starting with a hash character are seen as
+    // comments
+    if (cmd.size() == 0 || cmd[0] == '#') { return; }
+
+    // exit/quit the command loop?
+    if ("exit" == cmd || "quit" == cmd) {
+        line.kind = ScriptLine::Exit;
+        return;
+    }
+
+    // the lines of a "parallel {" ... "}" block do not depend on each other
+    // and may run concurrently
+    static const string parallel = "parallel";
+    if (0 == cmd.compare(0, parallel.length(), parallel) &&
+        "{" == trimmed(cmd.substr(parallel.length()))) {
+        line.kind = ScriptLine::Parallel;
+        return;
+    }
+
+    if ("}" == cmd) {
+        line.kind = ScriptLine::End;
+        return;
+    }
+
+    // lines starting with a dollar sign character denote the definition of
+    // a macro of the form: $macroName = macroValue
+    // whitespace around the equal sign is optional
+    // <macroName> can be any combination of A-Z, a-z, 0-9, or _
+    // <macroValue> is anything after the equal sign and whitespace-trimmed
+    // note that <macroValue> can be an empty string
+    // note that the dollar sign itself is part of the immediately following
+    // macro name
+    // note that a macro value stays valid for the entire lifetime of the
+    // command loop
+    // note that macro expansion is done on the command line before
+    // processing the line this means that a macro is allowed to contain
+    // command line escape characters
+    // note that macro expansion is recursive until no expansions are found
+    // any more this means that a macro is allowed to contain other macros
+    // note that a macro value is expanded when it is defined, so it is
+    // only expanded again on use if it refers to a macro defined later
+    if (cmd[0] == '$') {
+        // determine the macro name
+        size_t nameLength = 1;
+        while (nameLength < cmd.length() &&
+               (isalnum(cmd[nameLength]) || cmd[nameLength] == '_')) {
+            nameLength++;
+        }
+        string macroName = cmd.substr(0, nameLength);
+
+        // skip whitespace
+        size_t i = nameLength;
+        while (i < cmd.length() && isspace(cmd[i])) { i++; }
+
+        if (i == cmd.length() || cmd[i] != '=') {
+            otOut << "\n\n***ERROR***\n"
+                     "Expected macro definition of the form: "
+                     "$macroName = macroValue\n"
+                     "Command was: "
+                  << cmd;
+            line.kind = ScriptLine::Invalid;
+            return;
+        }
+
+        // remainder of line after trimming whitespace is macro value
+        macros_.define(macroName, trimmed(cmd.substr(i + 1)));
+        return;
+    }
+
+    // now replace any macro in the command line with its value
+    // unknown macro names will cause an error message instead of command
+    // execution
+    // note that all macro names are 'maximum munch'
+    // skip command when anything during macro expansion failed
+    if (!macros_.expand(cmd, line.expanded)) {
+        line.kind = ScriptLine::Invalid;
+        return;
+    }
+
+    // a trailing & separated by whitespace sends the command to the
+    // background
+    string& expanded = line.expanded;
+    size_t last = expanded.find_last_not_of(" \t");
+    if (0 < last && string::npos != last && '&' == expanded[last] &&
+        isspace(expanded[last - 1])) {
+        line.background = true;
+        expanded.erase(expanded.find_last_not_of(" \t", last - 1) + 1);
+    }
+
+    // Parse command string into its separate parts so it can be passed as
+    // an argc/argv combo
+    tokenizer_.tokenize(argv0_, line.expanded);
+
+    line.kind = ScriptLine::Command;
+    line.expectFailure = tokenizer_.expectFailure();
+    line.argc = tokenizer_.argc();
+    line.args.assign(tokenizer_.data());
+
+    // resolve the command now unless options precede it, in which case
+    // only AnyOption knows which argument the command is
+    const auto& args = tokenizer_.args();
+    if (1 < args.size() && '-' != args[1][0]) {
+        line.command = registry_.find(string(args[1]));
+    }
+}
+
+uint64_t CompiledScript::hash(const string& source)
+{
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : source) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool CompiledScript::isCompiled(const string& data)
+{
+    return 0 == data.compare(0, MAGIC_LENGTH, MAGIC);
+}
+
+bool CompiledScript::isCurrent(const string& data)
+{
+    if (!isCompiled(data)) { return false; }
+
+    Reader in(data);
+    uint64_t hash = 0;
+    return readHeader(in, hash);
+}
+
+bool CompiledScript::load(const string& data, uint64_t source)
+{
+    lines_.clear();
+
+    if (!isCompiled(data)) { return false; }
+
+    Reader in(data);
+    uint64_t hash = 0;
+    uint32_t count = 0;
+    if (!readHeader(in, hash) || (0 != source && source != hash) ||
+        !in.u32(count)) {
+        return false;
+    }
+
+    // the count is only trusted as far as there are lines to back it
+    for (uint32_t i = 0; i < count; i++) {
+        ScriptLine& line = lines_.emplace_back();
+        uint8_t kind = 0;
+        uint8_t expectFailure = 0;
+        uint8_t background = 0;
+        uint32_t lineNumber = 0;
+        uint32_t command = 0;
+        uint32_t argc = 0;
+        if (!in.u8(kind) || ScriptLine::End < kind ||
+            !in.u32(lineNumber) || !in.u8(expectFailure) ||
+            !in.u8(background) || !in.u32(command) || !in.str(line.text) ||
+            !in.str(line.expanded) || !in.u32(argc) || !in.str(line.args)) {
+            lines_.clear();
+            return false;
+        }
+        line.kind = static_cast<ScriptLine::Kind>(kind);
+        line.lineNumber = lineNumber;
+        line.expectFailure = 0 != expectFailure;
+        line.background = 0 != background;
+        line.command = static_cast<int32_t>(command);
+        line.argc = argc;
+        if (0 <= line.command &&
+            CmdRegistry::size() <= static_cast<size_t>(line.command)) {
+            lines_.clear();
+            return false;
+        }
+        // runLine() and notaryKey() walk args from zero to zero, so it has
+        // to hold exactly argc terminated arguments
+        if (!validArgs(line.args, argc) ||
+            (ScriptLine::Command == line.kind && 0 == argc)) {
+            lines_.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool CompiledScript::save(const string& path, uint64_t source) const
+{
+    Writer out;
+    out.data.append(MAGIC, MAGIC_LENGTH);
+    out.u32(FORMAT_VERSION);
+    out.u64(source);
+    out.str(fingerprint());
+    out.u32(lines_.size());
+
+    for (const auto& line : lines_) {
+        out.u8(line.kind);
+        out.u32(line.lineNumber);
+        out.u8(line.expectFailure ? 1 : 0);
+        out.u8(line.background ? 1 : 0);
+        out.u32(static_cast<uint32_t>(line.command));
+        out.str(line.text);
+        out.str(line.expanded);
+        out.u32(line.argc);
+        out.str(line.args);
+    }
+
+    ofstream file(path.c_str(), ios::out | ios::binary | ios::trunc);
+    file.write(out.data.data(), out.data.length());
+    return file.good();
+}
@@ -0,0 +1,121 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_SCRIPTCOMPILER_HPP__
+#define __OPENTXS_SCRIPTCOMPILER_HPP__
+
+#include "LineTokenizer.hpp"
+#include "MacroTable.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+class CmdRegistry;
+
+// One line of a script after trimming, macro expansion and tokenizing.
+struct ScriptLine {
+    typedef enum {
+        Echo = 0,     // comment, empty line or macro definition
+        Exit = 1,     // exit/quit the command loop
+        Invalid = 2,  // the error has already been reported
+        Command = 3,
+        Parallel = 4,  // "parallel {" opens a block of independent lines
+        End = 5,       // "}" closes it
+    } Kind;
+
+    Kind kind{Echo};
+    int32_t lineNumber{0};
+    bool expectFailure{false};
+    // a trailing & runs the command as a background job
+    bool background{false};
+    // index into CmdRegistry, -1 when it has to be looked up by name
+    int32_t command{-1};
+    std::string text;
+    std::string expanded;
+    // argc arguments, including argv[0], each followed by a zero
+    int32_t argc{0};
+    std::string args;
+};
+
+// Turns raw script/REPL input into ScriptLines, one line at a time.
+class ScriptCompiler
+{
+public:
+    ScriptCompiler(const CmdRegistry& registry, const char* argv0);
+
+    void compile(
+        int32_t lineNumber,
+        const std::string& input,
+        ScriptLine& line);
+
+private:
+    const CmdRegistry& registry_;
+    const char* argv0_;
+    MacroTable macros_;
+    LineTokenizer tokenizer_;
+};
+
+// A whole script in compiled form, so that it can be run again without
+// lexing, expanding macros or looking up commands by name.
+class CompiledScript
+{
+public:
+    static uint64_t hash(const std::string& source);
+    static bool isCompiled(const std::string& data);
+    // compiled by this build, with the current command table; only the
+    // header has to be present
+    static bool isCurrent(const std::string& data);
+
+    void add(const ScriptLine& line) { lines_.push_back(line); }
+    void clear() { lines_.clear(); }
+    const std::vector<ScriptLine>& lines() const { return lines_; }
+
+    // source is the hash of the script text; pass 0 to accept any script
+    bool load(const std::string& data, uint64_t source);
+    bool save(const std::string& path, uint64_t source) const;
+
+private:
+    std::vector<ScriptLine> lines_;
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_SCRIPTCOMPILER_HPP__
@@ -0,0 +1,152 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "StartupProfile.hpp"
+
+#include "MainOption.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <sys/time.h>
+#endif
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Phase {
+    const char* name;
+    double ms;
+    int64_t peakRssKb;
+};
+
+bool profiling = false;
+string outputPath;
+chrono::steady_clock::time_point started;
+chrono::steady_clock::time_point last;
+vector<Phase> phases;
+
+int64_t peak_rss_kb()
+{
+#ifdef _WIN32
+    return -1;
+#else
+    struct rusage usage;
+    if (0 != getrusage(RUSAGE_SELF, &usage)) { return -1; }
+#ifdef __APPLE__
+    // reported in bytes instead of kilobytes
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+double ms_between(
+    chrono::steady_clock::time_point from,
+    chrono::steady_clock::time_point to)
+{
+    return chrono::duration<double, milli>(to - from).count();
+}
+}  // namespace
+
+void StartupProfile::enable(int& argc, char* argv[])
+{
+    profiling = takeMainOption(argc, argv, "profile-startup", outputPath);
+
+    started = last = chrono::steady_clock::now();
+}
+
+bool StartupProfile::enabled() { return profiling; }
+
+void StartupProfile::mark(const char* phase)
+{
+    if (!profiling) { return; }
+
+    auto now = chrono::steady_clock::now();
+    phases.push_back({phase, ms_between(last, now), peak_rss_kb()});
+    last = now;
+}
+
+void StartupProfile::report()
+{
+    if (!profiling) { return; }
+
+    double total = ms_between(started, last);
+    ostringstream out;
+    out << fixed << setprecision(3);
+
+    if ("" == outputPath) {
+        out << "\nStartup profile:\n";
+        for (const auto& phase : phases) {
+            out << "  " << left << setw(24) << phase.name << right << setw(12)
+                << phase.ms << " ms  " << setw(10) << phase.peakRssKb
+                << " KB peak RSS\n";
+        }
+        out << "  " << left << setw(24) << "total" << right << setw(12)
+            << total << " ms\n";
+        otOut << out.str();
+        return;
+    }
+
+    out << "{\n  \"phases\": [\n";
+    for (size_t i = 0; i < phases.size(); i++) {
+        out << "    {\"name\": \"" << phases[i].name
+            << "\", \"ms\": " << phases[i].ms
+            << ", \"peak_rss_kb\": " << phases[i].peakRssKb << "}"
+            << (i + 1 < phases.size() ? "," : "") << "\n";
+    }
+    out << "  ],\n  \"total_ms\": " << total << "\n}\n";
+
+    ofstream file(outputPath.c_str(), ios::out | ios::trunc);
+    file << out.str();
+    if (!file.good()) {
+        otOut << "Error: cannot write startup profile: " << outputPath
+              << "\n";
+    }
+}
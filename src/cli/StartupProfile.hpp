@@ -0,0 +1,65 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_STARTUPPROFILE_HPP__
+#define __OPENTXS_STARTUPPROFILE_HPP__
+
+#include <string>
+
+namespace opentxs
+{
+
+// Times the phases of CLI startup for --profile-startup[=file.json].
+// Every mark() ends the phase that started at the previous mark, and
+// records its monotonic duration and the peak RSS of the process at that
+// point. All calls do nothing unless the profile has been enabled.
+class StartupProfile
+{
+public:
+    // removes --profile-startup[=file] from argv and enables profiling
+    // when it was present
+    static void enable(int& argc, char* argv[]);
+    static bool enabled();
+
+    static void mark(const char* phase);
+
+    // prints the breakdown, or writes it as JSON when a file was given
+    static void report();
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_STARTUPPROFILE_HPP__
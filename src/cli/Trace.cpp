@@ -0,0 +1,153 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Trace.hpp"
+
+#include "MainOption.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+struct Event {
+    string name;
+    const char* category;
+    int64_t started;
+    int64_t duration;
+    int thread;
+};
+
+bool tracing = false;
+string outputPath;
+mutex eventsLock;
+vector<Event> events;
+atomic<int> threads(0);
+
+int64_t now_us()
+{
+    return chrono::duration_cast<chrono::microseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// small, stable thread ids read better in a trace viewer than native ones
+int thread_id()
+{
+    thread_local int id = ++threads;
+    return id;
+}
+
+void write_json_string(ofstream& out, const string& value)
+{
+    out << '"';
+    for (char c : value) {
+        if ('"' == c || '\\' == c) {
+            out << '\\' << c;
+        } else if (0x20 > static_cast<unsigned char>(c)) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+}  // namespace
+
+void Trace::enable(int& argc, char* argv[])
+{
+    outputPath = "opentxs-trace.json";
+    tracing = takeMainOption(argc, argv, "trace", outputPath);
+}
+
+bool Trace::enabled() { return tracing; }
+
+Trace::Span::Span(const char* name, const char* category)
+    : name_(name)
+    , category_(category)
+    , started_(tracing ? now_us() : 0)
+{
+}
+
+Trace::Span::~Span()
+{
+    if (!tracing) { return; }
+
+    int64_t ended = now_us();
+    lock_guard<mutex> guard(eventsLock);
+    events.push_back(
+        {name_, category_, started_, ended - started_, thread_id()});
+}
+
+void Trace::write()
+{
+    if (!tracing) { return; }
+
+    lock_guard<mutex> guard(eventsLock);
+
+    ofstream out(outputPath.c_str(), ios::out | ios::trunc);
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+    const char* separator = "\n";
+    for (const auto& event : events) {
+        out << separator << "{\"name\": ";
+        write_json_string(out, event.name);
+        out << ", \"cat\": \"" << event.category
+            << "\", \"ph\": \"X\", \"ts\": " << event.started
+            << ", \"dur\": " << event.duration
+            << ", \"pid\": 1, \"tid\": " << event.thread << "}";
+        separator = ",\n";
+    }
+    out << "\n]}\n";
+
+    if (!out.good()) {
+        otOut << "Error: cannot write trace: " << outputPath << "\n";
+        return;
+    }
+    otOut << "Wrote " << events.size() << " trace events to " << outputPath
+          << "\n";
+}
@@ -0,0 +1,79 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_TRACE_HPP__
+#define __OPENTXS_TRACE_HPP__
+
+#include <stdint.h>
+#include <string>
+
+namespace opentxs
+{
+
+// Chrome trace-event export for --trace=file.json. Every Span becomes a
+// complete ("X") event on the thread that created it, so nested Spans show
+// up nested in chrome://tracing or Perfetto. Spans cost a single check
+// unless tracing has been enabled.
+class Trace
+{
+public:
+    // removes --trace[=file] from argv and enables tracing when it was
+    // present; the file defaults to opentxs-trace.json
+    static void enable(int& argc, char* argv[]);
+    static bool enabled();
+
+    // writes all recorded events to the trace file
+    static void write();
+
+    class Span
+    {
+    public:
+        explicit Span(const char* name, const char* category = "call");
+        ~Span();
+
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+
+    private:
+        const char* name_;
+        const char* category_;
+        int64_t started_;
+    };
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_TRACE_HPP__
@@ -0,0 +1,215 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "UnitCache.hpp"
+
+#include "Trace.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <ctype.h>
+#include <stdint.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+const char THOUSANDS_SEP = ',';
+const char DECIMAL_POINT = '.';
+// 10^18 is the largest power of ten an int64_t holds
+const int32_t MAX_POWER = 18;
+
+struct Formatter {
+    bool valid = false;
+    int32_t power = 0;
+    uint64_t factor = 1;
+    // with the space the library puts between symbol and amount
+    string prefix;
+};
+
+mutex cacheLock;
+unordered_map<string, Formatter> formatters;
+unordered_map<string, string> accountUnits;
+
+const Formatter& formatter(const string& unit)
+{
+    auto found = formatters.find(unit);
+    if (formatters.end() != found) { return found->second; }
+
+    // a missing contract is not remembered, it may be downloaded later
+    static const Formatter missing;
+    Trace::Span span("Wallet::UnitDefinition");
+    auto contract = OT::App().Wallet().UnitDefinition(Identifier(unit));
+    if (!contract) { return missing; }
+
+    Formatter& result = formatters[unit];
+    result.valid = true;
+    result.power = contract->DecimalPower();
+    if (0 > result.power) { result.power = 0; }
+    if (MAX_POWER < result.power) { result.power = MAX_POWER; }
+    for (int32_t i = 0; i < result.power; i++) { result.factor *= 10; }
+    result.prefix = contract->GetCurrencySymbol() + " ";
+    return result;
+}
+
+string formatAmount(const Formatter& unit, int64_t amount)
+{
+    // written backwards from the end: at most 20 digits, 6 separators and
+    // the decimal point
+    char buffer[32];
+    char* const end = buffer + sizeof(buffer);
+    char* digit = end;
+
+    uint64_t value = 0 > amount ? 0 - static_cast<uint64_t>(amount)
+                                : static_cast<uint64_t>(amount);
+
+    if (0 < unit.power) {
+        uint64_t fraction = value % unit.factor;
+        value /= unit.factor;
+        for (int32_t i = 0; i < unit.power; i++) {
+            *--digit = '0' + fraction % 10;
+            fraction /= 10;
+        }
+        *--digit = DECIMAL_POINT;
+    }
+
+    int32_t digits = 0;
+    do {
+        if (0 < digits && 0 == digits % 3) { *--digit = THOUSANDS_SEP; }
+        *--digit = '0' + value % 10;
+        value /= 10;
+        digits++;
+    } while (0 != value);
+
+    string text;
+    text.reserve(1 + unit.prefix.size() + (end - digit));
+    if (0 > amount) { text += '-'; }
+    text += unit.prefix;
+    text.append(digit, end);
+    return text;
+}
+
+bool parseAmount(const Formatter& unit, const string& text, int64_t& amount)
+{
+    uint64_t whole = 0;
+    uint64_t fraction = 0;
+    int32_t fractionDigits = 0;
+    bool negative = false;
+    bool afterPoint = false;
+    bool digits = false;
+
+    for (char c : text) {
+        if (iscntrl(static_cast<unsigned char>(c))) { break; }
+
+        if (!isdigit(static_cast<unsigned char>(c))) {
+            if (DECIMAL_POINT == c) {
+                if (afterPoint) { break; }
+                afterPoint = true;
+            } else if ('-' == c && !digits) {
+                negative = true;
+            }
+            // separators and currency symbols
+            continue;
+        }
+
+        digits = true;
+        const uint64_t value = c - '0';
+        if (afterPoint) {
+            if (fractionDigits < unit.power) {
+                fraction = fraction * 10 + value;
+                fractionDigits++;
+            }
+        } else {
+            // the scaled amount has to fit into an int64_t
+            if (whole > (INT64_MAX / unit.factor - value) / 10) {
+                return false;
+            }
+            whole = whole * 10 + value;
+        }
+    }
+
+    if (!digits) { return false; }
+
+    for (; fractionDigits < unit.power; fractionDigits++) { fraction *= 10; }
+    if (whole * unit.factor > INT64_MAX - fraction) { return false; }
+
+    const int64_t result = whole * unit.factor + fraction;
+    amount = negative ? -result : result;
+    return true;
+}
+}  // namespace
+
+bool UnitCache::format(const string& unit, int64_t amount, string& text)
+{
+    lock_guard<mutex> lock(cacheLock);
+    const Formatter& formatter = ::formatter(unit);
+    if (!formatter.valid) { return false; }
+    text = formatAmount(formatter, amount);
+    return true;
+}
+
+bool UnitCache::parse(const string& unit, const string& text, int64_t& amount)
+{
+    lock_guard<mutex> lock(cacheLock);
+    const Formatter& formatter = ::formatter(unit);
+    if (!formatter.valid) { return false; }
+    return parseAmount(formatter, text, amount);
+}
+
+string UnitCache::accountUnit(const string& account)
+{
+    lock_guard<mutex> lock(cacheLock);
+    auto found = accountUnits.find(account);
+    if (accountUnits.end() != found) { return found->second; }
+
+    Trace::Span span("SwigWrap::GetAccountWallet_InstrumentDefinitionID");
+    string unit = SwigWrap::GetAccountWallet_InstrumentDefinitionID(account);
+    if (!unit.empty()) { accountUnits.emplace(account, unit); }
+    return unit;
+}
+
+void UnitCache::invalidate()
+{
+    lock_guard<mutex> lock(cacheLock);
+    formatters.clear();
+    accountUnits.clear();
+}
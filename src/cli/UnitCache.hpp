@@ -0,0 +1,79 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_UNITCACHE_HPP__
+#define __OPENTXS_UNITCACHE_HPP__
+
+#include <stdint.h>
+#include <string>
+
+namespace opentxs
+{
+
+// Amount formatting and parsing for the unit definitions of the wallet.
+// SwigWrap::FormatAmount() and StringToAmount() load the unit contract on
+// every call; here each unit is loaded once per session into a formatter
+// with its decimal power and symbol, and amounts are converted with plain
+// integer arithmetic. The unit of each account is remembered as well.
+// Units and accounts that are not found are looked up again next time.
+//
+// The output matches the library's: "-$ 1,234.56" for -123456 in a unit
+// with symbol "$" and decimal power 2. Parsing is as lenient as the
+// library's: separators and other symbols are skipped, and digits after
+// the decimal power are ignored.
+class UnitCache
+{
+public:
+    // false when the unit is not in the wallet
+    static bool format(
+        const std::string& unit,
+        int64_t amount,
+        std::string& text);
+    static bool parse(
+        const std::string& unit,
+        const std::string& text,
+        int64_t& amount);
+
+    // "" when the account is not in the wallet
+    static std::string accountUnit(const std::string& account);
+
+    // called after commands that can add units or accounts
+    static void invalidate();
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_UNITCACHE_HPP__
@@ -0,0 +1,580 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CmdRegistry.hpp"
+#include "LineTokenizer.hpp"
+#include "OutputCapture.hpp"
+#include "commands/CmdBase.hpp"
+#include "opentxs.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// IDs from the opentxs-sample-data wallet, the same ones
+// scripts/tests/ot_test.opentxs uses
+const char* SERVER = "r1fUoHwJOWCuK3WBAAySjmKYqsG6G2TYIxdqY6YNuuG";
+const char* FTNYM = "DYEB6U7dcpbwdGrftPnslNKz76BDuBTFAjiAgKaiY2n";
+const char* BOBNYM = "HpDoVBTix9GRLvZZoKBi2zv2f4IFVLmRrW2Q0nAA0OH";
+const char* FTACCT = "yQGh0vgm9YiqYOh6bfLDxyAA7Nnh2NmturCQmOt4LTo";
+const char* BOBACCT = "O8uUtFNyeKUqYdaBrroDR9OIgPhvtW91iBBVNEfbHDC";
+const char* SILVERPURSE = "JY7kEFnm2c50CGNphdpgnlVo2hOZuLrBua5cFqWWR9Q";
+
+// number of macro definitions in the generated script
+const int SCRIPT_MACROS = 200;
+
+// number of command lines each --parse workload goes through per iteration
+const int PARSE_LINES = 10000;
+
+struct Workload {
+    const char* name;
+    // a single command for Opentxs::exec(), or the script for run()
+    vector<string> args;
+    bool script;
+    // needs the sample notary, see scripts/tests/local_notary.sh
+    bool notary;
+    // run() reads the generated script from stdin, which bypasses the
+    // script cache, so every run tokenizes and expands all of its lines
+    bool onStdin{false};
+};
+
+vector<Workload> workloads(const string& scriptPath)
+{
+    // the order is the report order, keep it fixed so reports diff cleanly
+    return {
+        {"wallet", {"showwallet"}, false, false},
+        {"accounts", {"showaccounts"}, false, false},
+        {"accounts-ndjson", {"showaccounts", "--format=ndjson"}, false, false},
+        {"nyms", {"shownyms"}, false, false},
+        {"servers", {"showservers"}, false, false},
+        {"balance", {"showbalance", "--myacct", FTACCT}, false, false},
+        {"inbox", {"inbox", "--myacct", FTACCT}, false, false},
+        {"outbox", {"outbox", "--myacct", FTACCT}, false, false},
+        {"records", {"showrecords", "--myacct", FTACCT}, false, false},
+        {"inpayments",
+         {"inpayments", "--server", SERVER, "--mynym", FTNYM},
+         false,
+         false},
+        {"expired",
+         {"showexpired", "--server", SERVER, "--mynym", FTNYM},
+         false,
+         false},
+        {"options",
+         {"showbalance",
+          "--myacct",
+          FTACCT,
+          "--mynym",
+          FTNYM,
+          "--server",
+          SERVER,
+          "--hisacct",
+          BOBACCT,
+          "--hisnym",
+          BOBNYM,
+          "--mypurse",
+          SILVERPURSE,
+          "--hispurse",
+          SILVERPURSE,
+          "--args",
+          "memo \"option parsing\" extra \"a b c\""},
+         false,
+         false},
+        {"purse",
+         {"showpurse",
+          "--server",
+          SERVER,
+          "--mynym",
+          FTNYM,
+          "--mypurse",
+          SILVERPURSE},
+         false,
+         false},
+        {"script", {"--noprompt"}, true, false, true},
+        // the same script from the cache of compiled scripts
+        {"script-cached",
+         {"--script", scriptPath, "--noprompt"},
+         true,
+         false},
+        {"ping",
+         {"pingnotary", "--server", SERVER, "--mynym", FTNYM},
+         false,
+         true},
+        {"refresh", {"refreshaccount", "--myacct", FTACCT}, false, true},
+        {"getmarkets",
+         {"getmarkets", "--server", SERVER, "--mynym", FTNYM},
+         false,
+         true},
+        {"transfer",
+         {"transfer",
+          "--myacct",
+          FTACCT,
+          "--hisacct",
+          BOBACCT,
+          "--amount",
+          "1",
+          "--memo",
+          "opentxs-bench"},
+         false,
+         true},
+        // after --receipts these list boxes with that many receipts
+        {"bob-inbox", {"inbox", "--myacct", BOBACCT}, false, true},
+        {"acceptall", {"acceptall", "--myacct", BOBACCT}, false, true},
+        {"bob-records", {"showrecords", "--myacct", BOBACCT}, false, true},
+        {"withdraw",
+         {"withdraw", "--myacct", FTACCT, "--amount", "1"},
+         false,
+         true},
+    };
+}
+
+string scriptText()
+{
+    ostringstream script;
+    script << "$SERVER = " << SERVER << "\n"
+           << "$FTNYM = " << FTNYM << "\n"
+           << "$FTACCT = " << FTACCT << "\n"
+           << "$SILVERPURSE = " << SILVERPURSE << "\n";
+    for (int i = 0; i < SCRIPT_MACROS; i++) {
+        script << "$MACRO" << i << " = value" << i << "\n";
+    }
+    for (int i = 0; i < 10; i++) {
+        script << "showbalance --myacct $FTACCT\n"
+               << "showpurse --server $SERVER --mynym $FTNYM "
+                  "--mypurse $SILVERPURSE\n"
+               << "showaccounts\n";
+    }
+    return script.str();
+}
+
+struct Result {
+    vector<int64_t> micros;
+    int failed{0};
+};
+
+int64_t percentile(const vector<int64_t>& sorted, int p)
+{
+    size_t index = (sorted.size() - 1) * p / 100;
+    return sorted[index];
+}
+
+void report(const Workload& workload, Result& result)
+{
+    auto& micros = result.micros;
+    sort(micros.begin(), micros.end());
+
+    int64_t total = 0;
+    for (auto time : micros) { total += time; }
+    double perSecond = 0 < total ? micros.size() * 1e6 / total : 0;
+
+    cout << left << setw(16) << workload.name << right << setw(8)
+         << micros.size() << setw(12) << fixed << setprecision(1)
+         << perSecond << setw(10) << micros.front() << setw(10)
+         << percentile(micros, 50) << setw(10) << percentile(micros, 95)
+         << setw(10) << percentile(micros, 99) << setw(10) << micros.back()
+         << setw(8) << result.failed << "\n";
+}
+
+// runs one command line with its output discarded, and with stdin read
+// from input when there is one
+int runQuiet(
+    Opentxs& cli,
+    vector<string> args,
+    bool script,
+    const string* input = nullptr)
+{
+    vector<char*> arguments;
+    for (auto& arg : args) { arguments.push_back(&arg[0]); }
+    arguments.push_back(nullptr);
+
+    istringstream in(nullptr != input ? *input : string());
+    streambuf* stdinBuffer = nullptr;
+    if (nullptr != input) { stdinBuffer = cin.rdbuf(in.rdbuf()); }
+
+    string output;
+    int status = 0;
+    {
+        OutputCapture capture(output);
+        status = script ? cli.run(args.size(), arguments.data())
+                        : cli.exec(args.size(), arguments.data());
+        CmdBase::flushOutput();
+    }
+
+    if (nullptr != input) {
+        cin.rdbuf(stdinBuffer);
+        cin.clear();
+    }
+    return status;
+}
+
+// Sends "count" transfers from FT to Bob and downloads Bob's inbox, so
+// that the bob-* workloads list boxes of that size.
+bool fillReceipts(Opentxs& cli, int count)
+{
+    cerr << "Sending " << count << " transfers to fill Bob's inbox...\n";
+    for (int i = 0; i < count; i++) {
+        int status = runQuiet(
+            cli,
+            {"opentxs",
+             "--dummy-passphrase",
+             "transfer",
+             "--myacct",
+             FTACCT,
+             "--hisacct",
+             BOBACCT,
+             "--amount",
+             "1",
+             "--memo",
+             "opentxs-bench receipt"},
+            false);
+        if (0 != status) {
+            cerr << "Transfer " << i << " failed.\n";
+            return false;
+        }
+    }
+
+    return 0 == runQuiet(
+                    cli,
+                    {"opentxs",
+                     "--dummy-passphrase",
+                     "refreshaccount",
+                     "--myacct",
+                     BOBACCT},
+                    false);
+}
+
+// Expanded script lines, as the tokenizer sees them after the macros
+// have been replaced, quotes, backslashes and expected failures included.
+vector<string> parseLines()
+{
+    const vector<string> sample = {
+        "showaccounts",
+        string("showbalance --myacct ") + FTACCT,
+        string("showpurse --server ") + SERVER + " --mynym " + FTNYM +
+            " --mypurse " + SILVERPURSE,
+        string("transfer --myacct ") + FTACCT + " --hisacct " + BOBACCT +
+            " --amount 10 --memo \"opentxs-bench transfer\"",
+        string("!sendmessage --mynym ") + FTNYM + " --hisnym " + BOBNYM +
+            " --args \"subject \\$notamacro\"",
+        string("   inbox   --myacct ") + FTACCT + "   --format=ndjson   ",
+    };
+
+    vector<string> lines;
+    lines.reserve(PARSE_LINES);
+    for (int i = 0; i < PARSE_LINES; i++) {
+        lines.push_back(sample[i % sample.size()]);
+    }
+    return lines;
+}
+
+// Runs pass() once to warm up and then "iterations" times, and prints
+// one line for the workload. pass() returns a count that depends on all
+// of its work, so that none of it can be optimized away.
+bool timeParse(const char* name, int iterations, function<size_t()> pass)
+{
+    vector<int64_t> micros;
+    size_t check = 0;
+    for (int i = 0; i <= iterations; i++) {
+        auto start = chrono::steady_clock::now();
+        check += pass();
+        auto elapsed = chrono::duration_cast<chrono::microseconds>(
+                           chrono::steady_clock::now() - start)
+                           .count();
+        if (0 != i) { micros.push_back(elapsed); }
+    }
+    if (0 == check) { return false; }
+
+    sort(micros.begin(), micros.end());
+
+    int64_t total = 0;
+    for (auto time : micros) { total += time; }
+    double perSecond =
+        0 < total ? double(PARSE_LINES) * iterations * 1e6 / total : 0;
+
+    cout << left << setw(16) << name << right << setw(12)
+         << int64_t(PARSE_LINES) * iterations << setw(14) << fixed
+         << setprecision(0) << perSecond << setw(10) << micros.front()
+         << setw(10) << percentile(micros, 50) << setw(10) << micros.back()
+         << "\n";
+    return true;
+}
+
+// The per-line work of a script run that needs neither a wallet nor a
+// notary, in lines per second. min/p50/max are microseconds per pass over
+// all PARSE_LINES lines.
+//
+// tokenize       splits each line into arguments
+// dispatch       looks up each line's command in the CmdRegistry
+// dispatch-scan  the same lookup as the CLI did before the registry: a
+//                linear scan over every command, all constructed up front
+int runParse(int iterations, const string& only)
+{
+    const vector<string> lines = parseLines();
+
+    LineTokenizer tokenizer;
+    vector<string> names;
+    for (const auto& line : lines) {
+        tokenizer.tokenize("opentxs", line);
+        names.push_back(tokenizer.argv()[1]);
+    }
+
+    cout << "opentxs-bench " << OPENTXS_CLI_VERSION_STRING
+         << " iterations=" << iterations << "\n"
+         << left << setw(16) << "workload" << right << setw(12) << "lines"
+         << setw(14) << "lines/s" << setw(10) << "min" << setw(10) << "p50"
+         << setw(10) << "max" << "\n";
+
+    bool found = false;
+    bool passed = true;
+
+    if (only.empty() || "tokenize" == only) {
+        found = true;
+        passed = passed && timeParse("tokenize", iterations, [&]() {
+                     size_t args = 0;
+                     for (const auto& line : lines) {
+                         tokenizer.tokenize("opentxs", line);
+                         args += tokenizer.argc();
+                     }
+                     return args;
+                 });
+    }
+
+    if (only.empty() || "dispatch" == only) {
+        found = true;
+        CmdRegistry registry;
+        passed = passed && timeParse("dispatch", iterations, [&]() {
+                     size_t hits = 0;
+                     for (const auto& name : names) {
+                         hits += 0 <= registry.find(name);
+                     }
+                     return hits;
+                 });
+    }
+
+    if (only.empty() || "dispatch-scan" == only) {
+        found = true;
+        vector<unique_ptr<CmdBase>> cmds;
+        for (size_t i = 0; i < CmdRegistry::size(); i++) {
+            cmds.emplace_back(CmdRegistry::entry(i).create());
+        }
+        passed = passed && timeParse("dispatch-scan", iterations, [&]() {
+                     size_t hits = 0;
+                     for (const auto& name : names) {
+                         for (const auto& cmd : cmds) {
+                             if (name == cmd->getCommand()) {
+                                 hits++;
+                                 break;
+                             }
+                         }
+                     }
+                     return hits;
+                 });
+    }
+
+    if (!found) {
+        cerr << "Unknown workload: " << only << "\n";
+        return -1;
+    }
+
+    return passed ? 0 : -1;
+}
+
+int usage(const char* argv0)
+{
+    cerr << "Usage: " << argv0
+         << " --data <sample data folder> [--iterations <n>]"
+            " [--workload <name>] [--notary [--receipts <n>]]\n"
+         << "       " << argv0
+         << " --parse [--iterations <n>] [--workload <name>]\n";
+    return -1;
+}
+}  // namespace
+
+// Runs a fixed set of commands against a private copy of the sample
+// wallet and reports per workload throughput and latency percentiles, in
+// microseconds. Command output is discarded, log output still goes to
+// stderr. The workloads that talk to a notary only run with --notary,
+// against the sample notary started by scripts/tests/local_notary.sh.
+int main(int argc, char* argv[])
+{
+    string data;
+    string only;
+    int iterations = 100;
+    bool notary = false;
+    bool parse = false;
+    int receipts = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && 0 == strcmp(argv[i], "--data")) {
+            data = argv[++i];
+        } else if (i + 1 < argc && 0 == strcmp(argv[i], "--iterations")) {
+            iterations = max(1, atoi(argv[++i]));
+        } else if (i + 1 < argc && 0 == strcmp(argv[i], "--workload")) {
+            only = argv[++i];
+        } else if (0 == strcmp(argv[i], "--notary")) {
+            notary = true;
+        } else if (0 == strcmp(argv[i], "--parse")) {
+            parse = true;
+        } else if (i + 1 < argc && 0 == strcmp(argv[i], "--receipts")) {
+            receipts = max(0, atoi(argv[++i]));
+        } else {
+            return usage(argv[0]);
+        }
+    }
+
+    if (parse) {
+        if (notary || 0 < receipts || !data.empty()) { return usage(argv[0]); }
+        return runParse(iterations, only);
+    }
+
+    if (data.empty()) {
+        const char* env = getenv("OPENTXS_SAMPLE_DATA");
+        if (nullptr != env) { data = env; }
+    }
+
+    if (data.empty() || (0 < receipts && !notary)) { return usage(argv[0]); }
+
+    // the client keeps its data in $HOME/.ot, so a temporary $HOME keeps
+    // the user's own wallet out of reach
+    string home = (filesystem::temp_directory_path() / "opentxs-bench-XXXXXX");
+    if (nullptr == mkdtemp(&home[0])) {
+        cerr << "Cannot create a temporary folder.\n";
+        return -1;
+    }
+
+    error_code error;
+    filesystem::copy(
+        data,
+        filesystem::path(home) / ".ot",
+        filesystem::copy_options::recursive,
+        error);
+    if (error) {
+        cerr << "Cannot copy the sample data from " << data << ": "
+             << error.message() << "\n";
+        filesystem::remove_all(home, error);
+        return -1;
+    }
+    setenv("HOME", home.c_str(), 1);
+
+    const string script = scriptText();
+    string scriptPath = home + "/bench.opentxs";
+    if (!(ofstream(scriptPath) << script)) {
+        cerr << "Cannot write " << scriptPath << "\n";
+        filesystem::remove_all(home, error);
+        return -1;
+    }
+
+    OT::ClientFactory({});
+    OT::App().API().OTAPI().LoadWallet();
+
+    cout << "opentxs-bench " << OPENTXS_CLI_VERSION_STRING
+         << " iterations=" << iterations << "\n"
+         << left << setw(16) << "workload" << right << setw(8) << "runs"
+         << setw(12) << "ops/s" << setw(10) << "min" << setw(10) << "p50"
+         << setw(10) << "p95" << setw(10) << "p99" << setw(10) << "max"
+         << setw(8) << "failed" << "\n";
+
+    bool found = false;
+    bool filled = true;
+    {
+        Opentxs cli;
+        filled = 0 == receipts || fillReceipts(cli, receipts);
+
+        for (const auto& workload : workloads(scriptPath)) {
+            if (!filled) { break; }
+            if (!only.empty() && only != workload.name) { continue; }
+            if (workload.notary && !notary) { continue; }
+            found = true;
+
+            vector<string> args;
+            args.push_back("opentxs");
+            args.push_back("--dummy-passphrase");
+            args.insert(args.end(), workload.args.begin(), workload.args.end());
+
+            Result result;
+            // the first run loads whatever the workload needs and is
+            // not counted
+            for (int i = 0; i <= iterations; i++) {
+                auto start = chrono::steady_clock::now();
+                int status = runQuiet(
+                    cli,
+                    args,
+                    workload.script,
+                    workload.onStdin ? &script : nullptr);
+                auto micros = chrono::duration_cast<chrono::microseconds>(
+                                  chrono::steady_clock::now() - start)
+                                  .count();
+
+                if (0 == i) { continue; }
+                result.micros.push_back(micros);
+                if (0 != status) { result.failed++; }
+            }
+
+            report(workload, result);
+        }
+    }
+
+    OT::Cleanup();
+    filesystem::remove_all(home, error);
+
+    if (!filled) { return -1; }
+
+    if (!found) {
+        cerr << "Unknown workload: " << only << "\n";
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "ipc.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+// Thin client for "opentxs --daemon". It forwards its command line to the
+// daemon, which runs the command with this process' stdin, stdout and
+// stderr, and then exits with the same status "opentxs <command>" would.
+int main(int argc, char* argv[])
+{
+    string socketPath;
+    int first = 1;
+
+    if (first + 1 < argc && 0 == strcmp(argv[first], "--socket")) {
+        socketPath = argv[first + 1];
+        first += 2;
+    }
+
+    if (socketPath.empty()) { socketPath = Ipc::defaultSocket(); }
+
+    if (socketPath.empty()) {
+        cerr << "Cannot determine the opentxs daemon socket. "
+                "Use --socket <path> or set OPENTXS_CLI_SOCKET.\n";
+        return -1;
+    }
+
+    if (first == argc) {
+        cerr << "Usage: " << argv[0]
+             << " [--socket <path>] <command> [options]\n";
+        return -1;
+    }
+
+    // the daemon parses the arguments exactly like the opentxs executable
+    vector<string> args;
+    args.push_back("opentxs");
+    for (int i = first; i < argc; i++) { args.push_back(argv[i]); }
+
+    int sock = Ipc::connectTo(socketPath);
+    if (0 > sock) {
+        cerr << "Cannot connect to the opentxs daemon at " << socketPath
+             << ". Is \"opentxs --daemon\" running?\n";
+        return -1;
+    }
+
+    int32_t status = -1;
+    if (!Ipc::sendRequest(sock, args) || !Ipc::receiveStatus(sock, status)) {
+        cerr << "Lost the connection to the opentxs daemon.\n";
+        status = -1;
+    }
+
+    close(sock);
+    return status;
+}
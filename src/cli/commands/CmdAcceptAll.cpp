@@ -46,13 +46,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>", "[--server <server>]"};
+}  // namespace
+
 CmdAcceptAll::CmdAcceptAll()
 {
-    command = "acceptall";
-    args[0] = "--myacct <account>";
-    args[1] = "[--server <server>]";
-    category = catAccounts;
-    help = "Accept all incoming transfers, receipts, payments, invoices.";
+    setArguments(arguments);
     usage = "Server is an Opentxs notary where you receive incoming messages (including payment instruments). Account is where you wish to deposit any cheques (etc) that are found. There's no guarantee that the account is on the same server where the messages are coming from. Unless you don't specify a server, of course, in which case it will use the account's server Id. But there's also no guarantee that the payment instrument is drawn on an account located on the same notary where your account is located. It's YOUR responsibility to make sure you pick the correct server and the correct account, which is basically impossible in the case of 'ALL'. (Which this is). Therefore this command is well-nigh useless. However, it could be easily updated to simply determine on its own which account is the correct one for each instrument, and to create an account if an appropriate one can't be found. Justus has a new function that does this, so we could just call that here, so it happens in the background. TODO HERE.";
 }
 
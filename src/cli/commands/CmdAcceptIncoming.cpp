@@ -45,12 +45,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>"};
+}  // namespace
+
 CmdAcceptIncoming::CmdAcceptIncoming()
 {
-    command = "acceptincoming";
-    args[0] = "--myacct <account>";
-    category = catAccounts;
-    help = "Accept all incoming payments in myacct's inbox.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAcceptIncoming::runWithOptions()
@@ -46,15 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--server <server>]",
+    "[--indices <indices|all>]"};
+}  // namespace
+
 CmdAcceptInvoices::CmdAcceptInvoices()
 {
-    command = "acceptinvoices";
-    args[0] = "--myacct <account>";
-    args[1] = "[--server <server>]";
-    args[2] = "[--indices <indices|all>]";
-    category = catAccounts;
-    help = "Pay all invoices in myacct's Nym's payments inbox on Server."
-    " (Confused yet? New API fixes this kind of problem).";
+    setArguments(arguments);
     usage = "Omitting --indices is the same as specifying --indices all. "
     "And FYI, it uses MyAcct's server if one is not provided.";
 }
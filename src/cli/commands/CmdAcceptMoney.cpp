@@ -46,13 +46,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>", "[--server <server>]"};
+}  // namespace
+
 CmdAcceptMoney::CmdAcceptMoney()
 {
-    command = "acceptmoney";
-    args[0] = "--myacct <account>";
-    args[1] = "[--server <server>]";
-    category = catAccounts;
-    help = "Accept all incoming transfers and payments into myacct.";
+    setArguments(arguments);
     usage = "Server is notary where I receive messages (and payments). "
     "FYI, the default server is myacct's NotaryId.";
 }
@@ -46,15 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--server <server>]",
+    "[--indices <indices|all>]"};
+}  // namespace
+
 CmdAcceptPayments::CmdAcceptPayments()
 {
-    command = "acceptpayments";
-    args[0] = "--myacct <account>";
-    args[1] = "[--server <server>]";
-    args[2] = "[--indices <indices|all>]";
-    category = catAccounts;
-    help = "Accept all incoming payments in myacct's Nym's payments inbox on "
-    "Server. Confused yet?";
+    setArguments(arguments);
     usage = "Omitting --indices is the same as specifying --indices all. "
     "Server defaults to myacct's NotaryId. (Better commands coming soon based "
     "on the new API).";
@@ -46,13 +46,16 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--indices <indices|all>]"};
+}  // namespace
+
 CmdAcceptReceipts::CmdAcceptReceipts()
 {
-    command = "acceptreceipts";
-    args[0] = "--myacct <account>";
-    args[1] = "[--indices <indices|all>]";
-    category = catAccounts;
-    help = "Accept all incoming receipts in myacct's inbox.";
+    setArguments(arguments);
     usage = "Omitting --indices is the same as specifying --indices all.";
 }
 
@@ -43,15 +43,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse ID for the request being acknowledged"};
+}  // namespace
+
 CmdAcknowledgeBailment::CmdAcknowledgeBailment()
 {
-    command = "acknowledgebailment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse ID for the request being acknowledged";
-    category = catOtherUsers;
-    help = "Respond to a bailment request with deposit instructions";
+    setArguments(arguments);
 }
 
 CmdAcknowledgeBailment::~CmdAcknowledgeBailment() {}
@@ -90,16 +93,16 @@ std::int32_t CmdAcknowledgeBailment::run(
 
     std::string response;
     {
-        response = OT::App()
-                           .API()
-                           .ServerAction()
-                           .AcknowledgeBailment(
-                               Identifier(mynym),
-                               Identifier(server),
-                               Identifier(hisnym),
-                               Identifier(mypurse),
-                               terms)
-                           ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AcknowledgeBailment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    terms));
     }
     return processResponse(response, "acknowledge bailment");
 }
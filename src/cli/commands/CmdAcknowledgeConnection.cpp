@@ -43,15 +43,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse ID for the request being acknowledged"};
+}  // namespace
+
 CmdAcknowledgeConnection::CmdAcknowledgeConnection()
 {
-    command = "acknowledgeconnection";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse ID for the request being acknowledged";
-    category = catOtherUsers;
-    help = "Respond to a connection request";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAcknowledgeConnection::runWithOptions()
@@ -81,27 +84,27 @@ std::int32_t CmdAcknowledgeConnection::run(
         return -1;
     }
 
-    std::string url = inputText("URL");
-    std::string login = inputText("User name");
-    std::string password = inputText("Password");
-    std::string key = inputText("Key");
+    std::string url = inputValue("URL");
+    std::string login = inputValue("User name");
+    std::string password = inputValue("Password");
+    std::string key = inputValue("Key");
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .AcknowledgeConnection(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse),
-                                   true,
-                                   url,
-                                   login,
-                                   password,
-                                   key)
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AcknowledgeConnection(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    true,
+                    url,
+                    login,
+                    password,
+                    key));
     }
 
     return processResponse(response, "acknowledge connection");
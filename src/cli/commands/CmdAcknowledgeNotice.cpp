@@ -43,15 +43,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse ID for the peer notice being acknowledged"};
+}  // namespace
+
 CmdAcknowledgeNotice::CmdAcknowledgeNotice()
 {
-    command = "acknowledgenotice";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse ID for the peer notice being acknowledged";
-    category = catOtherUsers;
-    help = "Acknowledge receipt of a peer notice";
+    setArguments(arguments);
 }
 
 CmdAcknowledgeNotice::~CmdAcknowledgeNotice() {}
@@ -85,16 +88,16 @@ std::int32_t CmdAcknowledgeNotice::run(
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .AcknowledgeNotice(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse),
-                                   true)
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AcknowledgeNotice(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    true));
     }
     return processResponse(response, "acknowledge notice");
 }
@@ -43,15 +43,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse ID for the request being acknowledged"};
+}  // namespace
+
 CmdAcknowledgeOutBailment::CmdAcknowledgeOutBailment()
 {
-    command = "acknowledgeoutbailment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse ID for the request being acknowledged";
-    category = catOtherUsers;
-    help = "Respond to an out bailment request with withdrawal instructions";
+    setArguments(arguments);
 }
 
 CmdAcknowledgeOutBailment::~CmdAcknowledgeOutBailment() {}
@@ -90,16 +93,16 @@ std::int32_t CmdAcknowledgeOutBailment::run(
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .AcknowledgeOutbailment(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse),
-                                   terms)
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AcknowledgeOutbailment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    terms));
     }
     return processResponse(response, "acknowledge outbailment");
 }
@@ -45,12 +45,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdActivitySummary::CmdActivitySummary()
 {
-    command = "activitysummary";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Display a summary of activity for a nym.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdActivitySummary::runWithOptions()
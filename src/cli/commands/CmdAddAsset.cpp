@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdAddAsset::CmdAddAsset()
-{
-    command = "addasset";
-    category = catWallet;
-    help = "Import an existing asset contract into your wallet.";
-}
+CmdAddAsset::CmdAddAsset() {}
 
 CmdAddAsset::~CmdAddAsset() {}
 
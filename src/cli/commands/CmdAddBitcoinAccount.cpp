@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdAddBitcoinAccount::CmdAddBitcoinAccount()
 {
-    command = "addbitcoinaccount";
-    args[0] = "--mynym <nym>";
-    category = catBlockchain;
-    help = "Instantiate a BIP-44 account";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAddBitcoinAccount::runWithOptions()
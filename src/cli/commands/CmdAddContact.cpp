@@ -42,13 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--hisnym <nym>", "--label [<label>]"};
+}  // namespace
+
 CmdAddContact::CmdAddContact()
 {
-    command = "addcontact";
-    args[0] = "--hisnym <nym>";
-    args[1] = "--label [<label>]";
-    category = catOtherUsers;
-    help = "Add a new contact based on Nym ID";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAddContact::runWithOptions()
@@ -42,14 +42,17 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--type <currency>",
+    "--value <instrument definition id>"};
+}  // namespace
+
 CmdAddContract::CmdAddContract()
 {
-    command = "addcontract";
-    args[0] = "--mynym <nym>";
-    args[1] = "--type <currency>";
-    args[2] = "--value <instrument definition id>";
-    category = catWallet;
-    help = "Edit a nym's contact credential data.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAddContract::runWithOptions()
@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdAddServer::CmdAddServer()
-{
-    command = "addserver";
-    category = catWallet;
-    help = "Import an existing server contract into your wallet.";
-}
+CmdAddServer::CmdAddServer() {}
 
 CmdAddServer::~CmdAddServer() {}
 
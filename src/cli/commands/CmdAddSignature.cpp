@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdAddSignature::CmdAddSignature()
 {
-    command = "addsignature";
-    args[0] = "--mynym <nym>";
-    category = catAdmin;
-    help = "Add a signature to a contract without erasing others.";
+    setArguments(arguments);
 }
 
 CmdAddSignature::~CmdAddSignature() {}
@@ -79,7 +81,7 @@ int32_t CmdAddSignature::run(string mynym)
     }
 
     dashLine();
-    cout << "Signed:\n" << output << "\n";
+    out() << "Signed:\n" << output << "\n";
 
     return 1;
 }
@@ -44,15 +44,18 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--account <account ID>",
+    "--label [<address label>]",
+    "--chain [<internal or external>]"};
+}  // namespace
+
 CmdAllocateBitcoinAddress::CmdAllocateBitcoinAddress()
 {
-    command = "allocatebitcoinaddress";
-    args[0] = "--mynym <nym>";
-    args[1] = "--account <account ID>";
-    args[2] = "--label [<address label>]";
-    args[3] = "--chain [<internal or external>]";
-    category = catBlockchain;
-    help = "Derive bitcoin addresses in a Bip44 account";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAllocateBitcoinAddress::runWithOptions()
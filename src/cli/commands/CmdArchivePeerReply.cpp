@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--mypurse <reply ID>"};
+}  // namespace
+
 CmdArchivePeerReply::CmdArchivePeerReply()
 {
-    command = "archivepeerreply";
-    args[0] = "--mynym <nym>";
-    args[1] = "--mypurse <reply ID>";
-    category = catOtherUsers;
-    help = "Move a reply to the processed box";
+    setArguments(arguments);
 }
 
 std::int32_t CmdArchivePeerReply::runWithOptions()
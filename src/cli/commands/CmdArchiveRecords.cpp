@@ -0,0 +1,216 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CmdArchiveRecords.hpp"
+
+#include "../LedgerSnapshot.hpp"
+#include "../ReceiptArchive.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+constexpr Arguments arguments{
+    "[--server <server>]",
+    "[--mynym <nym>]",
+    "[--myacct <account>]"};
+
+void addRows(
+    vector<ReceiptArchive::Row>& rows,
+    const LedgerSnapshot& box,
+    ReceiptArchive::Box kind,
+    const string& server,
+    const string& nym,
+    const string& account,
+    const string& unit)
+{
+    for (size_t i = 0; i < box.size(); i++) {
+        // the other side is the recipient of what nym sent
+        const bool sent = nym == box.senderNym[i];
+
+        ReceiptArchive::Row row;
+        row.box = kind;
+        row.date = box.date[i];
+        row.number = box.number[i];
+        row.reference = box.reference[i];
+        row.amount = box.amount[i];
+        row.server = server;
+        row.nym = nym;
+        row.account = account;
+        row.type = box.type[i];
+        row.counterpartyNym = sent ? box.recipientNym[i] : box.user(i);
+        row.counterpartyAccount =
+            sent ? box.recipientAccount[i] : box.account(i);
+        row.unit = unit;
+        rows.push_back(move(row));
+    }
+}
+}  // namespace
+
+CmdArchiveRecords::CmdArchiveRecords()
+{
+    setArguments(arguments);
+    usage = "Specify either one of --server/--mynym and --myacct.";
+}
+
+CmdArchiveRecords::~CmdArchiveRecords() {}
+
+int32_t CmdArchiveRecords::runWithOptions()
+{
+    return run(getOption("server"), getOption("mynym"), getOption("myacct"));
+}
+
+int32_t CmdArchiveRecords::run(string server, string mynym, string myacct)
+{
+    if ("" == myacct) {
+        if (!checkServer("server", server)) {
+            return -1;
+        }
+
+        if (!checkNym("mynym", mynym)) {
+            return -1;
+        }
+    } else {
+        if (!checkAccount("myacct", myacct)) {
+            return -1;
+        }
+
+        server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+        if ("" == server) {
+            otOut << "Error: cannot determine server from myacct.\n";
+            return -1;
+        }
+
+        mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+        if ("" == mynym) {
+            otOut << "Error: cannot determine mynym from myacct.\n";
+            return -1;
+        }
+    }
+
+    vector<ReceiptArchive::Row> rows;
+
+    LedgerSnapshot nymRecords;
+    if (!nymRecords.load(
+            LedgerSnapshot::Box::RecordBox, server, mynym, mynym)) {
+        otOut << "Error: cannot load record box.\n";
+        return -1;
+    }
+    addRows(
+        rows,
+        nymRecords,
+        ReceiptArchive::Box::NymRecords,
+        server,
+        mynym,
+        mynym,
+        "");
+
+    LedgerSnapshot expired;
+    if (!expired.load(LedgerSnapshot::Box::ExpiredBox, server, mynym, mynym)) {
+        otOut << "Error: cannot load expired record box.\n";
+        return -1;
+    }
+    addRows(
+        rows, expired, ReceiptArchive::Box::Expired, server, mynym, mynym, "");
+
+    LedgerSnapshot accountRecords;
+    if ("" != myacct) {
+        if (!accountRecords.load(
+                LedgerSnapshot::Box::RecordBox, server, mynym, myacct)) {
+            otOut << "Error: cannot load record box.\n";
+            return -1;
+        }
+
+        string assetType = getAccountAssetType(myacct);
+        if ("" == assetType) {
+            return -1;
+        }
+        addRows(
+            rows,
+            accountRecords,
+            ReceiptArchive::Box::AccountRecords,
+            server,
+            mynym,
+            myacct,
+            assetType);
+    }
+
+    if (rows.empty()) {
+        otOut << "There are no records to archive.\n";
+        return 0;
+    }
+
+    string path = ReceiptArchive::defaultPath();
+    if (!ReceiptArchive(path).append(move(rows))) {
+        otOut << "Error: cannot write the receipt archive " << path << "\n";
+        return -1;
+    }
+
+    // the boxes are only cleared once their receipts are on disk
+    bool success = true;
+    if (0 < nymRecords.size()) {
+        success &= SwigWrap::ClearRecord(server, mynym, mynym, 0, true);
+    }
+    if (0 < expired.size()) {
+        success &= SwigWrap::ClearExpired(server, mynym, 0, true);
+    }
+    if (0 < accountRecords.size()) {
+        success &= SwigWrap::ClearRecord(server, mynym, myacct, 0, true);
+    }
+
+    if (!success) {
+        otOut << "Error: the records were archived, but not all of them "
+                 "could be cleared. Use clearrecords and clearexpired to "
+                 "remove them instead of archiving them again.\n";
+        return -1;
+    }
+
+    otOut << "Archived "
+          << nymRecords.size() + expired.size() + accountRecords.size()
+          << " records.\n";
+    return 1;
+}
@@ -0,0 +1,62 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CLIENT_CMDARCHIVERECORDS_HPP
+#define OPENTXS_CLIENT_CMDARCHIVERECORDS_HPP
+
+#include "CmdBase.hpp"
+
+namespace opentxs
+{
+
+class CmdArchiveRecords : public CmdBase
+{
+public:
+    EXPORT CmdArchiveRecords();
+    virtual ~CmdArchiveRecords();
+
+    EXPORT int32_t
+        run(std::string server, std::string mynym, std::string myacct);
+
+protected:
+    virtual int32_t runWithOptions();
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDARCHIVERECORDS_HPP
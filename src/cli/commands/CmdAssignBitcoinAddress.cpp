@@ -44,16 +44,19 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--account <account ID>",
+    "--index <address index>",
+    "--contact [<contact ID>]",
+    "--chain [<internal or external>]"};
+}  // namespace
+
 CmdAssignBitcoinAddress::CmdAssignBitcoinAddress()
 {
-    command = "assignbitcoinaddress";
-    args[0] = "--mynym <nym>";
-    args[1] = "--account <account ID>";
-    args[2] = "--index <address index>";
-    args[3] = "--contact [<contact ID>]";
-    args[4] = "--chain [<internal or external>]";
-    category = catBlockchain;
-    help = "Assign a contact ID to a bitcoin address";
+    setArguments(arguments);
 }
 
 std::int32_t CmdAssignBitcoinAddress::runWithOptions()
@@ -38,21 +38,126 @@
 
 #include "CmdBase.hpp"
 
+#include "../CmdRegistry.hpp"
+#include "../LedgerSnapshot.hpp"
+#include "../UnitCache.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <ctype.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <charconv>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+// Listing commands write thousands of short rows; collecting them here
+// turns that into a few large writes to stdout.
+class OutputBuffer : public streambuf
+{
+public:
+    OutputBuffer()
+        : buffer_(64 * 1024)
+    {
+        setp(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+
+    ~OutputBuffer() { sync(); }
+
+protected:
+    int_type overflow(int_type c) override
+    {
+        if (0 != sync()) { return traits_type::eof(); }
+        if (traits_type::eq_int_type(c, traits_type::eof())) {
+            return traits_type::not_eof(c);
+        }
+        return sputc(traits_type::to_char_type(c));
+    }
+
+    int sync() override
+    {
+        if (pptr() != pbase()) {
+            cout.write(pbase(), pptr() - pbase());
+            setp(buffer_.data(), buffer_.data() + buffer_.size());
+        }
+        cout.flush();
+        return cout.good() ? 0 : -1;
+    }
+
+private:
+    vector<char> buffer_;
+};
+
+thread_local OutputBuffer outputBuffer;
+thread_local ostream output(&outputBuffer);
+
+// see CmdBase::NoInput
+thread_local bool noInput = false;
+
+// see CmdBase::ClientLock
+mutex clientMutex;
+thread_local bool clientLocked = false;
+
+bool stdinBlocked()
+{
+    if (noInput) {
+        otOut << "Error: cannot read stdin in a parallel block or a "
+                 "background job.\n";
+    }
+    return noInput;
+}
+
+// Reads a whole --input-file, or stdin for "-", without the line by line
+// terminator scan of OT_CLI_ReadUntilEOF(). A file is read straight into a
+// string of its own size, stdin in large chunks.
+bool readInput(const char* path, string& text)
+{
+    text.clear();
+
+    if (0 == strcmp(path, "-")) {
+        // istream::read keeps cin's state up to date, unlike sgetn on its
+        // buffer; a read error on the stdio-backed stdin looks like end of
+        // file to the buffer, so stdin's own error flag is checked too
+        vector<char> chunk(64 * 1024);
+        while (cin.read(chunk.data(), chunk.size()) || 0 < cin.gcount()) {
+            text.append(chunk.data(), cin.gcount());
+        }
+        return cin.eof() && !cin.bad() && !ferror(stdin);
+    }
+
+    ifstream file(path, ios::in | ios::binary | ios::ate);
+    if (!file) { return false; }
+
+    const streamoff size = file.tellg();
+    if (0 > size) { return false; }
+    text.resize(size);
+    file.seekg(0);
+    return bool(file.read(&text[0], size));
+}
+
+// a count of entries, 0 included
+bool parseCount(const string& text, size_t& count)
+{
+    const char* end = text.data() + text.size();
+    auto result = from_chars(text.data(), end, count);
+    return errc() == result.ec && end == result.ptr;
+}
+}  // namespace
+
 // used for passing and returning values when giving a
 // lambda function to a loop function.
 //
@@ -443,6 +548,7 @@ OTDB::OfferListNym* loadNymOffers(
     const std::string& notaryID,
     const std::string& nymID)
 {
+    Trace::Span span("loadNymOffers");
     OTDB::OfferListNym* offerList = nullptr;
 
     if (OTDB::Exists("nyms", notaryID, "offers", nymID + ".bin")) {
@@ -496,18 +602,18 @@ std::int32_t output_nymoffer_data(
 
     if (0 == nIndex)  // first iteration! (Output a header.)
     {
-        otOut << "\nScale:\t\t" << strScale << "\n";
-        otOut << "Asset:\t\t" << strInstrumentDefinitionID << "\n";
-        otOut << "Currency:\t" << strCurrencyTypeID << "\n";
-        otOut << "\nIndex\tTrans#\tType\tPrice\tAvailable\n";
+        CmdBase::out() << "\nScale:\t\t" << strScale << "\n";
+        CmdBase::out() << "Asset:\t\t" << strInstrumentDefinitionID << "\n";
+        CmdBase::out() << "Currency:\t" << strCurrencyTypeID << "\n";
+        CmdBase::out() << "\nIndex\tTrans#\tType\tPrice\tAvailable\n";
     }
 
     //
     // Okay, we have the offer_data, so let's output it!
     //
-    std::cout << (nIndex) << "\t" << offer_data.transaction_id << "\t"
-              << strSellStatus << "\t" << offer_data.price_per_scale << "\t"
-              << strAvailableAssets << "\n";
+    CmdBase::out() << (nIndex) << "\t" << offer_data.transaction_id << "\t"
+                   << strSellStatus << "\t" << offer_data.price_per_scale
+                   << "\t" << strAvailableAssets << "\n";
 
     return 1;
 }
@@ -516,14 +622,15 @@ std::int32_t output_nymoffer_data(
 
 
 CmdBase::CmdBase()
-    : category(catError)
-    , command(nullptr)
-    , help(nullptr)
-    , usage(nullptr)
+    : usage(nullptr)
+    , ndjsonRows(false)
+    , argumentTable(nullptr)
+    , argumentCount(0)
+    , values(nullptr)
+    , format("text")
+    , input(nullptr)
+    , inputUsed(false)
 {
-    for (int i = 0; i < MAX_ARGS; i++) {
-        args[i] = nullptr;
-    }
 }
 
 CmdBase::~CmdBase() {}
@@ -538,12 +645,12 @@ std::string CmdBase::check_nym(
     auto action = OT::App().API().ServerAction().DownloadNym(
         Identifier(nymID), Identifier(notaryID), Identifier(targetNymID));
 
-    return action->Run();
+    return notaryRun(action);
 }
 
 bool CmdBase::checkAccount(const char* name, string& account) const
 {
-    return OTRecordList::checkAccount(name, account);
+    return resolve(name, Resolver::Kind::Account, "account", account, true);
 }
 
 int64_t CmdBase::checkAmount(
@@ -560,7 +667,7 @@ int64_t CmdBase::checkAmount(
         return OT_ERROR_AMOUNT;
     }
 
-    int64_t value = SwigWrap::StringToAmount(assetType, amount);
+    int64_t value = parseAmount(assetType, amount);
     if (OT_ERROR_AMOUNT == value) {
         otOut << "Error: " << name << ": invalid amount: " << amount << "\n";
         return OT_ERROR_AMOUNT;
@@ -611,66 +718,53 @@ bool CmdBase::checkMandatory(const char* name, const string& value) const
 
 bool CmdBase::checkNym(const char* name, string& nym, bool checkExistance) const
 {
-    return OTRecordList::checkNym(name, nym, checkExistance);
+    return resolve(name, Resolver::Kind::Nym, "nym", nym, checkExistance);
 }
 
-bool CmdBase::checkPurse(const char* name, string& purse) const
+bool CmdBase::checkPaging(Paging& paging) const
 {
-    if (!checkMandatory(name, purse)) return false;
-
-    Identifier theID(purse);
-    ConstUnitDefinition pUnit;  // shared_ptr to const.
-
-    // See if it's available using the full length ID.
-    if (!theID.empty()) pUnit = OT::App().Wallet().UnitDefinition(theID);
+    string offset = getOption("offset");
+    if ("" != offset && !parseCount(offset, paging.offset)) {
+        otOut << "Error: offset: not a value: " << offset << "\n";
+        return false;
+    }
 
-    if (!pUnit) {
-        const auto units = OT::App().Wallet().UnitDefinitionList();
+    string limit = getOption("limit");
+    if ("" != limit && !parseCount(limit, paging.limit)) {
+        otOut << "Error: limit: not a value: " << limit << "\n";
+        return false;
+    }
 
-        // See if it's available using the partial length ID.
-        for (auto& it : units) {
-            if (0 == it.first.compare(0, purse.length(), purse)) {
-                pUnit = OT::App().Wallet().UnitDefinition(Identifier(it.first));
-                break;
-            }
-        }
-        if (!pUnit) {
-            // See if it's available using the full length name.
-            for (auto& it : units) {
-                if (0 == it.second.compare(0, it.second.length(), purse)) {
-                    pUnit =
-                        OT::App().Wallet().UnitDefinition(Identifier(it.first));
-                    break;
-                }
-            }
+    string since = getOption("since");
+    if ("" != since && !Paging::parseTime(since, paging.since)) {
+        otOut << "Error: since: invalid time: " << since << "\n";
+        return false;
+    }
 
-            if (!pUnit) {
-                // See if it's available using the partial name.
-                for (auto& it : units) {
-                    if (0 == it.second.compare(0, purse.length(), purse)) {
-                        pUnit = OT::App().Wallet().UnitDefinition(
-                            Identifier(it.first));
-                        break;
-                    }
-                }
-            }
-        }
+    string until = getOption("until");
+    if ("" != until && !Paging::parseTime(until, paging.until)) {
+        otOut << "Error: until: invalid time: " << until << "\n";
+        return false;
     }
 
-    if (!pUnit) {
-        otOut << "Error: " << name << ": unknown unit definition: " << purse
-              << "\n";
+    if (paging.since >= paging.until) {
+        otOut << "Error: until: must be later than since.\n";
         return false;
     }
 
-    purse = pUnit->ID()->str();
-    otOut << "Using " << name << ": " << purse << "\n";
+    paging.newestFirst = "true" == getOption("reverse");
     return true;
 }
 
+bool CmdBase::checkPurse(const char* name, string& purse) const
+{
+    return resolve(
+        name, Resolver::Kind::Unit, "unit definition", purse, true);
+}
+
 bool CmdBase::checkServer(const char* name, string& server) const
 {
-    return OTRecordList::checkServer(name, server);
+    return resolve(name, Resolver::Kind::Server, "server", server, true);
 }
 
 int64_t CmdBase::checkTransNum(const char* name, const string& id) const
@@ -714,31 +808,62 @@ bool CmdBase::checkValue(const char* name, const string& value) const
 void CmdBase::dashLine() const
 {
     // 76 dashes :-)
-    cout << "--------------------------------------"
+    out() << "--------------------------------------"
             "--------------------------------------\n";
 }
 
-const vector<string>& CmdBase::extractArgumentNames()
+ostream& CmdBase::out() { return output; }
+
+void CmdBase::flushOutput() { output.flush(); }
+
+CmdBase::NoInput::NoInput()
+    : previous_(noInput)
 {
-    // only do this once
-    if (0 != argNames.size()) {
-        return argNames;
+    noInput = true;
+}
+
+CmdBase::NoInput::~NoInput() { noInput = previous_; }
+
+CmdBase::ClientLock::ClientLock()
+    : locked_(!clientLocked)
+{
+    if (locked_) {
+        clientMutex.lock();
+        clientLocked = true;
     }
+}
 
-    // extract argument names from usage help text
-    for (int i = 0; i < MAX_ARGS && args[i] != nullptr; i++) {
-        const char* arg = args[i];
-        while ('[' == *arg || '-' == *arg) {
-            arg++;
-        }
-        string argName = "";
-        for (; isalpha(*arg); arg++) {
-            argName += *arg;
-        }
-        argNames.push_back(argName);
+CmdBase::ClientLock::~ClientLock()
+{
+    if (locked_) {
+        clientLocked = false;
+        clientMutex.unlock();
     }
+}
 
-    return argNames;
+CmdBase::RoundTripUnlock::RoundTripUnlock()
+    : unlocked_(clientLocked)
+{
+    if (unlocked_) {
+        clientLocked = false;
+        clientMutex.unlock();
+    }
+}
+
+CmdBase::RoundTripUnlock::~RoundTripUnlock()
+{
+    if (unlocked_) {
+        clientMutex.lock();
+        clientLocked = true;
+    }
+}
+
+int32_t CmdBase::findArgument(string_view name) const
+{
+    for (size_t i = 0; i < argumentCount; i++) {
+        if (name == argumentTable[i].name) { return i; }
+    }
+    return -1;
 }
 
 string CmdBase::formatAmount(const string& assetType, int64_t amount) const
@@ -753,35 +878,82 @@ string CmdBase::formatAmount(const string& assetType, int64_t amount) const
         return to_string(amount);
     }
 
-    return SwigWrap::FormatAmount(assetType, amount);
+    string text;
+    if (!UnitCache::format(assetType, amount, text)) {
+        // unit definition not in the wallet
+        return to_string(amount);
+    }
+    return text;
+}
+
+const Argument& CmdBase::getArgument(size_t index) const
+{
+    OT_ASSERT(index < argumentCount);
+    return argumentTable[index];
 }
 
-Category CmdBase::getCategory() const { return category; }
+size_t CmdBase::getArgumentCount() const { return argumentCount; }
 
-const char* CmdBase::getCommand() const { return command; }
+Category CmdBase::getCategory() const
+{
+    const auto* entry = CmdRegistry::entry(*this);
+    return nullptr == entry ? catError : entry->category;
+}
 
-const char* CmdBase::getHelp() const { return help; }
+const char* CmdBase::getCommand() const
+{
+    const auto* entry = CmdRegistry::entry(*this);
+    return nullptr == entry ? "" : entry->command;
+}
+
+const char* CmdBase::getHelp() const
+{
+    const auto* entry = CmdRegistry::entry(*this);
+    return nullptr == entry ? "" : entry->help;
+}
 
 string CmdBase::getAccountAssetType(const string& myacct) const
 {
-    string assetType =
-        SwigWrap::GetAccountWallet_InstrumentDefinitionID(myacct);
+    string assetType = UnitCache::accountUnit(myacct);
     if ("" == assetType) {
         otOut << "Error: cannot load instrument definition from myacct.\n";
     }
     return assetType;
 }
 
-string CmdBase::getOption(string optionName) const
+string CmdBase::getOption(string_view optionName) const
 {
-    auto result = options.find(optionName);
-    if (result == options.end()) {
-        otWarn << "Option " << optionName << " not found.\n";
+    int32_t index = findArgument(optionName);
+    if (0 > index || nullptr == values || nullptr == (*values)[index]) {
+        otWarn << "Option " << string(optionName) << " not found.\n";
         return "";
     }
 
-    otInfo << "Option  " << result->first << ": " << result->second << "\n";
-    return result->second;
+    const char* value = (*values)[index];
+    otInfo << "Option  " << string(optionName) << ": " << value << "\n";
+    return value;
+}
+
+bool CmdBase::ndjson() const { return 0 == strcmp(format, "ndjson"); }
+
+const char* CmdBase::outputFormat(const char* given, const char* fallback)
+    const
+{
+    const char* format = nullptr != given ? given : fallback;
+    if (nullptr == format || 0 == strcmp(format, "text")) { return "text"; }
+
+    if (0 != strcmp(format, "ndjson")) {
+        otOut << "Error: unknown --format " << format
+              << ", expected text or ndjson.\n";
+        return nullptr;
+    }
+
+    if (ndjsonRows) { return "ndjson"; }
+    if (nullptr == given) { return "text"; }
+
+    otOut << "Error: " << getCommand()
+          << " does not support --format=ndjson.\n";
+    return nullptr;
 }
 
 string CmdBase::getUsage() const
@@ -789,11 +961,11 @@ string CmdBase::getUsage() const
     stringstream ss;
 
     // construct usage string
-    ss << "Usage:   " << command;
-    for (int i = 0; i < MAX_ARGS && args[i] != nullptr; i++) {
-        ss << " " << args[i];
+    ss << "Usage:   " << getCommand();
+    for (size_t i = 0; i < argumentCount; i++) {
+        ss << " " << argumentTable[i].usage;
     }
-    ss << "\n\n" << help << "\n\n";
+    ss << "\n\n" << getHelp() << "\n\n";
     if (usage != nullptr) {
         ss << usage << "\n\n";
     }
@@ -803,6 +975,7 @@ string CmdBase::getUsage() const
 
 OTWallet* CmdBase::getWallet() const
 {
+    Trace::Span span("OT_API::GetWallet");
     OTWallet* wallet = OT::App().API().OTAPI().GetWallet();
     OT_ASSERT_MSG(wallet != nullptr, "Cannot load wallet->\n");
     return wallet;
@@ -810,23 +983,56 @@ OTWallet* CmdBase::getWallet() const
 
 int32_t CmdBase::harvestTxNumbers(const string& contract, const string& mynym)
 {
+    Trace::Span span("SwigWrap::Msg_HarvestTransactionNumbers");
     SwigWrap::Msg_HarvestTransactionNumbers(
         contract, mynym, false, false, false, false, false);
     return -1;
 }
 
-string CmdBase::inputLine() { return OT_CLI_ReadLine(); }
+string CmdBase::inputLine()
+{
+    if (stdinBlocked()) { return ""; }
+
+    // the prompt has to be visible before we wait for an answer
+    flushOutput();
+    return OT_CLI_ReadLine();
+}
 
 string CmdBase::inputText(const char* what)
 {
-    cout << "Please paste " << what << ",\n"
-         << "followed by an EOF or a ~ on a line by itself:\n";
+    bool pasted = nullptr == input || inputUsed;
+    if ((pasted || 0 == strcmp(input, "-")) && stdinBlocked()) {
+        otOut << "Use --input-file <file> for " << what << ".\n";
+        return "";
+    }
+
+    if (pasted) { return inputValue(what); }
+    inputUsed = true;
+
+    string text;
+    if (!readInput(input, text)) {
+        otOut << "Error: cannot read " << what << " from " << input << ".\n";
+        return "";
+    }
+    if ("" == text) {
+        otOut << "Error: " << input << " does not contain " << what << ".\n";
+    }
+    return text;
+}
+
+string CmdBase::inputValue(const char* what)
+{
+    if (stdinBlocked()) { return ""; }
+
+    out() << "Please paste " << what << ",\n"
+          << "followed by an EOF or a ~ on a line by itself:\n";
+    flushOutput();
 
-    string input = OT_CLI_ReadUntilEOF();
-    if ("" == input) {
+    string text = OT_CLI_ReadUntilEOF();
+    if ("" == text) {
         otOut << "Error: you did not paste " << what << ".\n";
     }
-    return input;
+    return text;
 }
 
 int32_t CmdBase::processResponse(const string& response, const char* what) const
@@ -844,7 +1050,7 @@ int32_t CmdBase::processResponse(const string& response, const char* what) const
             return -1;
     }
 
-    cout << response << "\n";
+    out() << response << "\n";
     return 1;
 }
 
@@ -870,11 +1076,86 @@ int32_t CmdBase::processTxResponse(
         return -1;
     }
 
-    cout << response << "\n";
+    out() << response << "\n";
 
     return 1;
 }
 
+int64_t CmdBase::parseAmount(const string& assetType, const string& amount)
+    const
+{
+    int64_t value = OT_ERROR_AMOUNT;
+    if (!UnitCache::parse(assetType, amount, value)) {
+        return OT_ERROR_AMOUNT;
+    }
+    return value;
+}
+
+void CmdBase::receiptLine(
+    const LedgerSnapshot& box,
+    size_t index,
+    const string& user,
+    const string& acct) const
+{
+    bool haveUser = "" != user;
+    bool haveAcct = "" != acct;
+
+    string separator = (haveUser || haveAcct)
+                           ? "\n                                 |"
+                           : "";
+    string userDenoter = haveUser ? "U:" : "";
+    string acctDenoter = haveAcct ? "A:" : "";
+    string assetType = haveAcct ? getAccountAssetType(acct) : "";
+
+    string fmtAmount = formatAmount(assetType, box.amount[index]);
+    const string& type = box.type[index];
+    int64_t txNum = box.number[index];
+    int64_t refNum = box.reference[index];
+
+    out() << box.position[index] << "    ";
+    out() << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
+    out() << type << (type.size() > 10 ? " " : "    ");
+    out() << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
+    out() << refNum << (to_string(refNum).size() > 2 ? "  " : " ") << "|";
+    out() << userDenoter << user << separator << acctDenoter << acct << "\n";
+}
+
+bool CmdBase::resolve(
+    const char* name,
+    Resolver::Kind kind,
+    const char* what,
+    string& value,
+    bool mustExist) const
+{
+    if (!checkMandatory(name, value)) {
+        return false;
+    }
+
+    string id;
+    switch (Resolver::resolve(kind, value, id)) {
+        case Resolver::Result::Found:
+            value = id;
+            break;
+
+        case Resolver::Result::Ambiguous:
+            otOut << "Error: " << name << ": more than one " << what
+                  << " matches: " << value << "\n";
+            return false;
+
+        case Resolver::Result::Unknown:
+            // may still be the full ID of someone else's nym
+            if (mustExist) {
+                otOut << "Error: " << name << ": unknown " << what << ": "
+                      << value << "\n";
+                return false;
+            }
+            break;
+    }
+
+    otOut << "Using " << name << ": " << value << "\n";
+    return true;
+}
+
 int32_t CmdBase::responseReply(
     const string& response,
     const string& server,
@@ -891,11 +1172,24 @@ int32_t CmdBase::responseStatus(const string& response) const
     return VerifyMessageSuccess(response);
 }
 
-bool CmdBase::run(const map<string, string>& _options)
+bool CmdBase::run(
+    const Values& _values,
+    const char* _format,
+    const char* _input)
 {
-    options = _options;
+    values = &_values;
+    format = _format;
+    input = _input;
+    inputUsed = false;
     int32_t returnValue = runWithOptions();
-    options.clear();
+    if (nullptr != input && !inputUsed) {
+        otOut << "Warning: " << getCommand()
+              << " does not read --input-file.\n";
+    }
+    values = nullptr;
+    format = "text";
+    input = nullptr;
+    flushOutput();
 
     switch (returnValue) {
         case 0:  // no action performed, return success
@@ -914,6 +1208,7 @@ bool CmdBase::run(const map<string, string>& _options)
 
 std::string CmdBase::stat_asset_account(const std::string& ACCOUNT_ID) const
 {
+    Trace::Span span("stat_asset_account");
     std::string strNymID = SwigWrap::GetAccountWallet_NymID(ACCOUNT_ID);
 
     if (!VerifyStringVal(strNymID)) {
@@ -922,8 +1217,7 @@ std::string CmdBase::stat_asset_account(const std::string& ACCOUNT_ID) const
         return "";
     }
 
-    std::string strInstrumentDefinitionID =
-        SwigWrap::GetAccountWallet_InstrumentDefinitionID(ACCOUNT_ID);
+    std::string strInstrumentDefinitionID = UnitCache::accountUnit(ACCOUNT_ID);
 
     if (!VerifyStringVal(strInstrumentDefinitionID)) {
         otOut << "\nstat_asset_account: Cannot cannot determine instrument "
@@ -940,8 +1234,7 @@ std::string CmdBase::stat_asset_account(const std::string& ACCOUNT_ID) const
     std::string strNymName = SwigWrap::GetNym_Name(strNymID);
     std::string strServerName = SwigWrap::GetServer_Name(strNotaryID);
 
-    return "   Balance: " +
-           SwigWrap::FormatAmount(strInstrumentDefinitionID, lBalance) +
+    return "   Balance: " + formatAmount(strInstrumentDefinitionID, lBalance) +
            "   (" + strName + ")\nAccount ID: " + ACCOUNT_ID + " ( " + strName +
            " )\nAsset Type: " + strInstrumentDefinitionID + " ( " +
            strAssetTypeName + " )\nOwner Nym : " + strNymID + " ( " +
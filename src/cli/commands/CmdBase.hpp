@@ -45,11 +45,23 @@
 #ifndef OPENTXS_CLIENT_CMDBASE_HPP
 #define OPENTXS_CLIENT_CMDBASE_HPP
 
+#include "../CommandStats.hpp"
+#include "../JsonRow.hpp"
+#include "../Paging.hpp"
+#include "../Resolver.hpp"
+#include "../Trace.hpp"
+
 #include <opentxs/opentxs.hpp>
 
+#include <stddef.h>
+#include <array>
+#include <iostream>
 #include <vector>
 #include <map>
 #include <mutex>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 
 // #ifndef SWIG
 // #include "opentxs/core/OTStorage.hpp"
@@ -143,25 +155,196 @@ typedef enum {
     catLast = 11
 } Category;
 
+// What an argument names, for the code that resolves it.
+enum class ArgKind { Text, Nym, Account, Server, Purse };
+
+// One command argument, parsed from its usage text at compile time:
+// "--myacct <account>" is mandatory, "[--memo <memoline>]" is optional and
+// "[--aggregate]" is a flag that takes no value. A usage text that does not
+// start with --name, or an optional one that is not closed, does not
+// compile.
+class Argument
+{
+public:
+    template <size_t N>
+    constexpr Argument(const char (&text)[N])
+        : usage(text)
+        , name(parseName(text, N - 1))
+        , required('[' != text[0])
+        , flag(name.size() + (required ? 2 : 4) == N - 1)
+        , kind(kindOf(name))
+        , defaultKey(defaultKeyOf(name))
+    {
+    }
+
+    const char* usage;
+    std::string_view name;
+    bool required;
+    bool flag;
+    ArgKind kind;
+    // the options file entry that supplies a missing value, or nullptr
+    const char* defaultKey;
+
+private:
+    static constexpr bool isLetter(char c)
+    {
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+    }
+
+    static constexpr std::string_view parseName(const char* text, size_t size)
+    {
+        const bool optional = '[' == text[0];
+        size_t begin = optional ? 3 : 2;
+        if (size <= begin || '-' != text[begin - 2] || '-' != text[begin - 1]) {
+            throw std::logic_error("argument usage must start with --name");
+        }
+        if (optional && ']' != text[size - 1]) {
+            throw std::logic_error("optional argument usage must end with ]");
+        }
+
+        size_t end = begin;
+        while (end < size && isLetter(text[end])) { end++; }
+        if (begin == end) {
+            throw std::logic_error("argument usage must start with --name");
+        }
+
+        return std::string_view(text + begin, end - begin);
+    }
+
+    static constexpr ArgKind kindOf(std::string_view name)
+    {
+        if ("mynym" == name || "hisnym" == name) { return ArgKind::Nym; }
+        if ("myacct" == name || "hisacct" == name) { return ArgKind::Account; }
+        if ("mypurse" == name || "hispurse" == name) { return ArgKind::Purse; }
+        if ("server" == name) { return ArgKind::Server; }
+        return ArgKind::Text;
+    }
+
+    static constexpr const char* defaultKeyOf(std::string_view name)
+    {
+        if ("hisacct" == name) { return "defaulthisacct"; }
+        if ("hisnym" == name) { return "defaulthisnym"; }
+        if ("hispurse" == name) { return "defaulthispurse"; }
+        if ("myacct" == name) { return "defaultmyacct"; }
+        if ("mynym" == name) { return "defaultmynym"; }
+        if ("mypurse" == name) { return "defaultmypurse"; }
+        if ("server" == name) { return "defaultserver"; }
+        return nullptr;
+    }
+};
+
+// The argument table of a command, declared as
+//
+//     constexpr Arguments arguments{"--myacct <account>", "[--memo <memo>]"};
+//
+// and checked at compile time for duplicate names and for fitting into
+// MAX_ARGS.
+template <size_t N>
+class Arguments
+{
+public:
+    template <typename... Text>
+    constexpr Arguments(const Text&... text)
+        : list{Argument(text)...}
+    {
+        static_assert(N <= MAX_ARGS, "a command takes at most MAX_ARGS");
+        for (size_t i = 0; i < N; i++) {
+            for (size_t j = i + 1; j < N; j++) {
+                if (list[i].name == list[j].name) {
+                    throw std::logic_error("duplicate argument name");
+                }
+            }
+        }
+    }
+
+    Argument list[N];
+};
+
+template <typename... Text>
+Arguments(const Text&...)->Arguments<sizeof...(Text)>;
+
+class LedgerSnapshot;
+
 class CmdBase
 {
 public:
     EXPORT CmdBase();
     virtual ~CmdBase();
 
-    EXPORT const std::vector<std::string>& extractArgumentNames();
+    // Argument values in the order of the command's Arguments, pointing
+    // into the command line or the options file; nullptr when not given.
+    typedef std::array<const char*, MAX_ARGS> Values;
+
+    // returns -1 when the command has no such argument
+    EXPORT int32_t findArgument(std::string_view name) const;
+    EXPORT const Argument& getArgument(size_t index) const;
+    EXPORT size_t getArgumentCount() const;
     EXPORT Category getCategory() const;
     EXPORT const char* getCommand() const;
     EXPORT const char* getHelp() const;
     virtual std::string getUsage() const;
-    EXPORT bool run(const std::map<std::string, std::string>& _options);
+    // The format to run with: the --format given on the command line, or
+    // the defaultformat of the options file, or text; given and fallback
+    // are nullptr when not set. Returns nullptr after an error message when
+    // the format is unknown, or when ndjson is given to a command that only
+    // writes text. A default of ndjson falls back to text for those.
+    EXPORT const char* outputFormat(
+        const char* given,
+        const char* fallback) const;
+    // input names the --input-file that replaces the pasted document, "-"
+    // for stdin, or is nullptr
+    EXPORT bool run(
+        const Values& values,
+        const char* format,
+        const char* input = nullptr);
+
+    // Command output. It is collected in a large per-thread buffer and only
+    // written to stdout when the command ends, when the buffer is full, or
+    // by flushOutput() before the command waits for input.
+    EXPORT static std::ostream& out();
+    EXPORT static void flushOutput();
+
+    // While a NoInput exists, commands on the current thread cannot read
+    // stdin: prompts and "--input -" fail with an error instead. Parallel
+    // blocks and background jobs run under one, since stdin belongs to the
+    // script or the interactive loop on the main thread.
+    class NoInput
+    {
+    public:
+        EXPORT NoInput();
+        EXPORT ~NoInput();
+
+        NoInput(const NoInput&) = delete;
+        NoInput& operator=(const NoInput&) = delete;
+
+    private:
+        bool previous_;
+    };
+
+    // Nothing documents the client API (SwigWrap, OT_API, the wallet and its
+    // storage) as safe to call from several threads at once, so a command
+    // holds a ClientLock while it works with the wallet. notaryRun() and the
+    // other round trips below let go of it while they wait on the notary;
+    // that is where parallel blocks and background jobs overlap. Taking it
+    // again on a thread that holds it does nothing.
+    class ClientLock
+    {
+    public:
+        EXPORT ClientLock();
+        EXPORT ~ClientLock();
+
+        ClientLock(const ClientLock&) = delete;
+        ClientLock& operator=(const ClientLock&) = delete;
+
+    private:
+        bool locked_;
+    };
 
 protected:
-    const char* args[MAX_ARGS];
-    Category category;
-    const char* command;
-    const char* help;
+    // the name, category and help text are in the CmdRegistry table
     const char* usage;
+    // the command writes --format=ndjson rows, see ndjson()
+    bool ndjsonRows;
 
     std::string check_nym(
         const std::string& NOTARY_ID,
@@ -189,6 +372,8 @@ protected:
         const char* name,
         std::string& nym,
         bool checkExistance = true) const;
+    // --offset, --limit, --since, --until and --reverse
+    bool checkPaging(Paging& paging) const;
     bool checkPurse(const char* name, std::string& purse) const;
     bool checkServer(const char* name, std::string& server) const;
     int64_t checkTransNum(const char* name, const std::string& id) const;
@@ -197,13 +382,65 @@ protected:
     std::string formatAmount(const std::string& assetType, int64_t amount)
         const;
     std::string getAccountAssetType(const std::string& myacct) const;
-    std::string getOption(std::string optionName) const;
+    std::string getOption(std::string_view optionName) const;
     OTWallet* getWallet() const;
+    // Releases the ClientLock of the current thread, if it holds one, until
+    // the round trip is over.
+    class RoundTripUnlock
+    {
+    public:
+        EXPORT RoundTripUnlock();
+        EXPORT ~RoundTripUnlock();
+
+        RoundTripUnlock(const RoundTripUnlock&) = delete;
+        RoundTripUnlock& operator=(const RoundTripUnlock&) = delete;
+
+    private:
+        bool unlocked_;
+    };
+
+    // notary requests go through these, so that --stats can tell round
+    // trips from local work, and so that other commands can use the client
+    // while the request is on the wire
+    template <typename Action>
+    std::string notaryRun(const Action& action) const
+    {
+        CommandStats::RoundTrip roundTrip;
+        RoundTripUnlock unlock;
+        Trace::Span span("ServerAction::Run", "notary");
+        return action->Run();
+    }
+    template <typename... Args>
+    bool downloadAccount(Args&&... args) const
+    {
+        CommandStats::RoundTrip roundTrip;
+        RoundTripUnlock unlock;
+        Trace::Span span("ServerAction::DownloadAccount", "notary");
+        return OT::App().API().ServerAction().DownloadAccount(
+            std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    bool getTransactionNumbers(Args&&... args) const
+    {
+        CommandStats::RoundTrip roundTrip;
+        RoundTripUnlock unlock;
+        Trace::Span span("ServerAction::GetTransactionNumbers", "notary");
+        return OT::App().API().ServerAction().GetTransactionNumbers(
+            std::forward<Args>(args)...);
+    }
     int32_t harvestTxNumbers(
         const std::string& contract,
         const std::string& mynym);
     std::string inputLine();
+    // a pasted document, or the whole --input-file when one was given
     std::string inputText(const char* what);
+    // a short pasted value, always read interactively
+    std::string inputValue(const char* what);
+    // true when the listing should be written as --format=ndjson rows
+    bool ndjson() const;
+    // OT_ERROR_AMOUNT when the amount or the unit is unusable
+    int64_t parseAmount(const std::string& assetType, const std::string& amount)
+        const;
     int32_t processResponse(const std::string& response, const char* what)
         const;
     int32_t processTxResponse(
@@ -212,6 +449,12 @@ protected:
         const std::string& myacct,
         const std::string& response,
         const char* what) const;
+    // one "Idx  Amt  Type  Txn# InRef#|User / Acct" line of a box listing
+    void receiptLine(
+        const LedgerSnapshot& box,
+        size_t index,
+        const std::string& user,
+        const std::string& acct) const;
     int32_t responseReply(
         const std::string& response,
         const std::string& server,
@@ -220,14 +463,33 @@ protected:
         const char* function) const;
     int32_t responseStatus(const std::string& response) const;
     virtual int32_t runWithOptions() = 0;
+    template <size_t N>
+    void setArguments(const Arguments<N>& table)
+    {
+        argumentTable = table.list;
+        argumentCount = N;
+    }
     std::vector<std::string> tokenize(
         const std::string& str,
         char delim,
         bool noEmpty) const;
 
 private:
-    std::vector<std::string> argNames;
-    std::map<std::string, std::string> options;
+    // resolves value to the full ID of a wallet object, see Resolver
+    bool resolve(
+        const char* name,
+        Resolver::Kind kind,
+        const char* what,
+        std::string& value,
+        bool mustExist) const;
+
+    const Argument* argumentTable;
+    size_t argumentCount;
+    // only set while the command runs
+    const Values* values;
+    const char* format;
+    const char* input;
+    bool inputUsed;
 };
 
 }  // namespace opentxs
@@ -81,15 +81,15 @@ int32_t CmdBaseInstrument::sendPayment(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .SendPayment(
-                              Identifier(sender),
-                              Identifier(server),
-                              Identifier(recipient),
-                              payment)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .SendPayment(
+                    Identifier(sender),
+                    Identifier(server),
+                    Identifier(recipient),
+                    payment));
     }
     return processResponse(response, what);
 }
@@ -132,7 +132,7 @@ string CmdBaseInstrument::writeCheque(
     }
 
     {
-        if (!OT::App().API().ServerAction().GetTransactionNumbers(
+        if (!getTransactionNumbers(
                 Identifier(mynym), Identifier(server), 10)) {
             otOut << "Error: cannot reserve transaction numbers.\n";
             return "";
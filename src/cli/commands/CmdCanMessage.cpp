@@ -42,13 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--sender <nym>", "--recipient <nym>"};
+}  // namespace
+
 CmdCanMessage::CmdCanMessage()
 {
-    command = "canmessage";
-    args[0] = "--sender <nym>";
-    args[1] = "--recipient <nym>";
-    category = catOtherUsers;
-    help = "Determine if prerequisites for messaging are met";
+    setArguments(arguments);
 }
 
 int32_t CmdCanMessage::runWithOptions()
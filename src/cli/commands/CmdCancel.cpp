@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "[--myacct <account>]",
+    "--indices <indices|all>"};
+}  // namespace
+
 CmdCancel::CmdCancel()
 {
-    command = "cancel";
-    args[0] = "--mynym <nym>";
-    args[1] = "[--myacct <account>]";
-    args[2] = "--indices <indices|all>";
-    category = catInstruments;
-    help = "Cancel an uncashed outgoing instrument from outpayment box.";
+    setArguments(arguments);
     usage = "Specify --myacct when canceling a smart contract.";
 }
 
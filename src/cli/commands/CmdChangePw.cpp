@@ -46,12 +46,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdChangePw::CmdChangePw()
-{
-    command = "changepw";
-    category = catWallet;
-    help = "Change the master passphrase for the wallet.";
-}
+CmdChangePw::CmdChangePw() {}
 
 CmdChangePw::~CmdChangePw() {}
 
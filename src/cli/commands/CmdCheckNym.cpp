@@ -46,14 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>"};
+}  // namespace
+
 CmdCheckNym::CmdCheckNym()
 {
-    command = "checknym";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    category = catOtherUsers;
-    help = "Download hisnym's public key.";
+    setArguments(arguments);
 }
 
 CmdCheckNym::~CmdCheckNym() {}
@@ -110,12 +113,12 @@ int32_t CmdCheckNym::run(string server, string mynym, string hisnym)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .DownloadNym(
-                Identifier(mynym), Identifier(server), Identifier(hisnym))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadNym(
+                    Identifier(mynym), Identifier(server), Identifier(hisnym)));
     }
     return processResponse(response, "check nym");
 }
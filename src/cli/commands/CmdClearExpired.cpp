@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdClearExpired::CmdClearExpired()
 {
-    command = "clearexpired";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMisc;
-    help = "Clear all mynym's expired records.";
+    setArguments(arguments);
 }
 
 CmdClearExpired::~CmdClearExpired() {}
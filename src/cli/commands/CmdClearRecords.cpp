@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>"};
+}  // namespace
+
 CmdClearRecords::CmdClearRecords()
 {
-    command = "clearrecords";
-    args[1] = "--myacct <account>";
-    category = catMisc;
-    help = "Clear all archived records and receipts.";
+    setArguments(arguments);
 }
 
 CmdClearRecords::~CmdClearRecords() {}
@@ -51,16 +51,19 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "[--myacct <account>]",
+    "[--hisnym <nym>]",
+    "[--index <index>]"};
+}  // namespace
+
 CmdConfirm::CmdConfirm()
 {
-    command = "confirm";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "[--myacct <account>]";
-    args[3] = "[--hisnym <nym>]";
-    args[4] = "[--index <index>]";
-    category = catInstruments;
-    help = "Confirm your agreement to a smart contract or payment plan.";
+    setArguments(arguments);
 }
 
 CmdConfirm::~CmdConfirm() {}
@@ -263,7 +266,7 @@ int32_t CmdConfirm::confirmSmartContract(
         return -1;
     }
 
-    cout << "\nWhich party are you? Enter the number, from the list above: ";
+    out() << "\nWhich party are you? Enter the number, from the list above: ";
     int32_t party = checkIndex("party number", inputLine(), parties);
     if (0 > party) {
         return -1;
@@ -422,16 +425,16 @@ int32_t CmdConfirm::activateContract(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .ActivateSmartContract(
-                              theNymID,
-                              theNotaryID,
-                              theAcctID,
-                              myAcctAgentName,
-                              smartContract)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .ActivateSmartContract(
+                    theNymID,
+                    theNotaryID,
+                    theAcctID,
+                    myAcctAgentName,
+                    smartContract));
     }
     if (1 != responseStatus(response)) {
         otOut << "Error: cannot activate smart contract.\n";
@@ -447,7 +450,7 @@ int32_t CmdConfirm::activateContract(
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
+        if (!downloadAccount(
                 theNymID, theNotaryID, theAcctID, true)) {
             otOut << "Error retrieving intermediary files for account.\n";
         }
@@ -505,15 +508,15 @@ int32_t CmdConfirm::sendToNextParty(
     auto payment = std::make_shared<const OTPayment>(String(contract.c_str()));
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .SendPayment(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(hisNymID),
-                              payment)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .SendPayment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisNymID),
+                    payment));
         if (1 != responseStatus(response)) {
             otOut << "\nFor whatever reason, our attempt to send the instrument on "
             "to the next user has failed.\n";
@@ -813,7 +816,7 @@ int32_t CmdConfirm::confirmAccounts(
         int32_t needed = SwigWrap::SmartContract_CountNumsNeeded(
             contract, mapAgents[x->first]);
 
-        if (!OT::App().API().ServerAction().GetTransactionNumbers(
+        if (!getTransactionNumbers(
                 Identifier(mynym), Identifier(server), needed + 1)) {
             otOut << "Error: cannot reserve transaction numbers.\n";
             return -1;
@@ -873,9 +876,9 @@ bool CmdConfirm::showPartyAccounts(
     }
 
     if (0 == depth) {
-        cout << "Party '" << name << "' has " << accounts
-             << (1 == accounts ? " asset account." : " asset accounts.")
-             << "\n";
+        out() << "Party '" << name << "' has " << accounts
+              << (1 == accounts ? " asset account." : " asset accounts.")
+              << "\n";
         return true;
     }
 
@@ -891,26 +894,26 @@ bool CmdConfirm::showPartyAccounts(
             SwigWrap::Party_GetAcctInstrumentDefinitionID(
                 contract, name, acctName);
         if ("" != acctInstrumentDefinitionID) {
-            cout << "-------------------\nAccount '" << acctName << "' (index "
-                 << i << " on Party '" << name
-                 << "') has instrument definition: "
-                 << acctInstrumentDefinitionID << " ("
-                 << SwigWrap::GetAssetType_Name(acctInstrumentDefinitionID)
-                 << ")\n";
+            out() << "-------------------\nAccount '" << acctName << "' (index "
+                  << i << " on Party '" << name
+                  << "') has instrument definition: "
+                  << acctInstrumentDefinitionID << " ("
+                  << SwigWrap::GetAssetType_Name(acctInstrumentDefinitionID)
+                  << ")\n";
         }
 
         string acctID = SwigWrap::Party_GetAcctID(contract, name, acctName);
         if ("" != acctID) {
-            cout << "Account '" << acctName << "' (party '" << name
-                 << "') is confirmed as Account ID: " << acctID << " ("
-                 << SwigWrap::GetAccountWallet_Name(acctID) << ")\n";
+            out() << "Account '" << acctName << "' (party '" << name
+                  << "') is confirmed as Account ID: " << acctID << " ("
+                  << SwigWrap::GetAccountWallet_Name(acctID) << ")\n";
         }
 
         string strAcctAgentName =
             SwigWrap::Party_GetAcctAgentName(contract, name, acctName);
         if ("" != strAcctAgentName) {
-            cout << "Account '" << acctName << "' (party '" << name
-                 << "') is managed by agent: " << strAcctAgentName << "\n";
+            out() << "Account '" << acctName << "' (party '" << name
+                  << "') is managed by agent: " << strAcctAgentName << "\n";
         }
     }
 
@@ -930,8 +933,8 @@ bool CmdConfirm::showPartyAgents(
     }
 
     if (0 == depth) {
-        cout << "Party '" << name << "' has " << agentCount
-             << (1 == agentCount ? " agent." : " agents.") << "\n";
+        out() << "Party '" << name << "' has " << agentCount
+              << (1 == agentCount ? " agent." : " agents.") << "\n";
         return true;
     }
 
@@ -945,12 +948,12 @@ bool CmdConfirm::showPartyAgents(
 
         string agentID = SwigWrap::Party_GetAgentID(contract, name, agent);
         if ("" != agentID) {
-            cout << "--------------------\n " << i << " : Agent '" << agent
-                 << "' (party '" << name << "') has NymID: " << agentID << " ('"
-                 << SwigWrap::GetNym_Name(agentID) << "')\n";
+            out() << "--------------------\n " << i << " : Agent '" << agent
+                  << "' (party '" << name << "') has NymID: " << agentID
+                  << " ('" << SwigWrap::GetNym_Name(agentID) << "')\n";
         } else {
-            cout << " " << i << " : Agent '" << agent << "' (party '" << name
-                 << "') has no NymID assigned (yet.)\n";
+            out() << " " << i << " : Agent '" << agent << "' (party '" << name
+                  << "') has no NymID assigned (yet.)\n";
         }
     }
 
@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--contact <nym>"};
+}  // namespace
+
 CmdContactName::CmdContactName()
 {
-    command = "contactname";
-    args[0] = "--contact <nym>";
-    category = catOtherUsers;
-    help = "Retrieve the label for a contact";
+    setArguments(arguments);
 }
 
 std::int32_t CmdContactName::runWithOptions()
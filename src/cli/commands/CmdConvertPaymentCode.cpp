@@ -45,12 +45,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--code <payment code>"};
+}  // namespace
+
 CmdConvertPaymentCode::CmdConvertPaymentCode()
 {
-    command = "convertpaymentcode";
-    args[0] = "--code <payment code>";
-    category = catMisc;
-    help = "Convert a BIP-47 payment code to a nym ID";
+    setArguments(arguments);
 }
 
 std::int32_t CmdConvertPaymentCode::runWithOptions()
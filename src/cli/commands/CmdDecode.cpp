@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdDecode::CmdDecode()
-{
-    command = "decode";
-    category = catAdmin;
-    help = "Decode OT-armored input text.";
-}
+CmdDecode::CmdDecode() {}
 
 CmdDecode::~CmdDecode() {}
 
@@ -73,7 +68,7 @@ int32_t CmdDecode::run()
 
     dashLine();
     otOut << "Decoded:\n\n";
-    cout << output << "\n";
+    out() << output << "\n";
 
     return 1;
 }
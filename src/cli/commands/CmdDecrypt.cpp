@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdDecrypt::CmdDecrypt()
 {
-    command = "decrypt";
-    args[0] = "--mynym <nym>";
-    category = catAdmin;
-    help = "Decrypt encrypted input text using mynym's private key.";
+    setArguments(arguments);
 }
 
 CmdDecrypt::~CmdDecrypt() {}
@@ -78,7 +80,7 @@ int32_t CmdDecrypt::run(string mynym)
 
     dashLine();
     otOut << "Decrypted:\n\n";
-    cout << output << "\n";
+    out() << output << "\n";
 
     return 1;
 }
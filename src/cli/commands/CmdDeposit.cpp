@@ -48,14 +48,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--mynym <nym>]",
+    "[--indices <indices|all>]"};
+}  // namespace
+
 CmdDeposit::CmdDeposit()
 {
-    command = "deposit";
-    args[0] = "--myacct <account>";
-    args[1] = "[--mynym <nym>]";
-    args[2] = "[--indices <indices|all>]";
-    category = catAccounts;
-    help = "Deposit cash, cheque, voucher, or invoice.";
+    setArguments(arguments);
     usage =
         "Any supplied indices must correspond to tokens in your cash purse.";
 }
@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdDepositCheques::CmdDepositCheques()
 {
-    command = "depositcheques";
-    args[0] = "--mynym <nym>";
-    category = catWallet;
-    help = "Deposit all undeposited cheques";
+    setArguments(arguments);
 }
 
 std::int32_t CmdDepositCheques::runWithOptions()
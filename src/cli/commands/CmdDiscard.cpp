@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--indices <indices|all>"};
+}  // namespace
+
 CmdDiscard::CmdDiscard()
 {
-    command = "discard";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--indices <indices|all>";
-    category = catInstruments;
-    help = "Discard uncashed incoming instruments from payments inbox.";
+    setArguments(arguments);
 }
 
 CmdDiscard::~CmdDiscard() {}
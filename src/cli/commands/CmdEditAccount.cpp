@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>", "--label <label>"};
+}  // namespace
+
 CmdEditAccount::CmdEditAccount()
 {
-    command = "editaccount";
-    args[0] = "--myacct <account>";
-    args[1] = "--label <label>";
-    category = catWallet;
-    help = "Edit myacct's label, as it appears in your wallet.";
+    setArguments(arguments);
 }
 
 CmdEditAccount::~CmdEditAccount() {}
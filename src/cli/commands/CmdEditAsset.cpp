@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mypurse <purse>", "--label <label>"};
+}  // namespace
+
 CmdEditAsset::CmdEditAsset()
 {
-    command = "editasset";
-    args[0] = "--mypurse <purse>";
-    args[1] = "--label <label>";
-    category = catWallet;
-    help = "Edit mypurse's label, as it appears in your wallet.";
+    setArguments(arguments);
 }
 
 CmdEditAsset::~CmdEditAsset() {}
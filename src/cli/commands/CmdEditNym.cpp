@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--label <label>"};
+}  // namespace
+
 CmdEditNym::CmdEditNym()
 {
-    command = "editnym";
-    args[0] = "--mynym <nym>";
-    args[1] = "--label <label>";
-    category = catWallet;
-    help = "Edit mynym's label, as it appears in your wallet.";
+    setArguments(arguments);
 }
 
 CmdEditNym::~CmdEditNym() {}
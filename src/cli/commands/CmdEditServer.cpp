@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--label <label>"};
+}  // namespace
+
 CmdEditServer::CmdEditServer()
 {
-    command = "editserver";
-    args[0] = "--server <server>";
-    args[1] = "--label <label>";
-    category = catWallet;
-    help = "Edit server's label, as it appears in your wallet.";
+    setArguments(arguments);
 }
 
 CmdEditServer::~CmdEditServer() {}
@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdEncode::CmdEncode()
-{
-    command = "encode";
-    category = catAdmin;
-    help = "Encode plaintext input to OT-armored text.";
-}
+CmdEncode::CmdEncode() {}
 
 CmdEncode::~CmdEncode() {}
 
@@ -73,7 +68,7 @@ int32_t CmdEncode::run()
 
     dashLine();
     otOut << "Encoded:\n\n";
-    cout << output << "\n";
+    out() << output << "\n";
 
     return 1;
 }
@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--hisnym <nym>"};
+}  // namespace
+
 CmdEncrypt::CmdEncrypt()
 {
-    command = "encrypt";
-    args[0] = "--hisnym <nym>";
-    category = catAdmin;
-    help = "Encrypt plaintext input using hisnym's public key.";
+    setArguments(arguments);
 }
 
 CmdEncrypt::~CmdEncrypt() {}
@@ -78,7 +80,7 @@ int32_t CmdEncrypt::run(string hisnym)
 
     dashLine();
     otOut << "Encrypted:\n\n";
-    cout << output << "\n";
+    out() << output << "\n";
 
     return 1;
 }
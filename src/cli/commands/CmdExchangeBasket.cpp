@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <basketaccount>",
+    "[--direction <in|out> (default in)]",
+    "[--multiple <multiple> (default 1)]"};
+}  // namespace
+
 CmdExchangeBasket::CmdExchangeBasket()
 {
-    command = "exchangebasket";
-    args[0] = "--myacct <basketaccount>";
-    args[1] = "[--direction <in|out> (default in)]";
-    args[2] = "[--multiple <multiple> (default 1)]";
-    category = catBaskets;
-    help = "Exchange in or out of a basket currency.";
+    setArguments(arguments);
 }
 
 CmdExchangeBasket::~CmdExchangeBasket() {}
@@ -145,7 +148,7 @@ int32_t CmdExchangeBasket::run(string myacct, string direction, string multiple)
     }
 
     {
-        if (!OT::App().API().ServerAction().GetTransactionNumbers(
+        if (!getTransactionNumbers(
                 Identifier(mynym), Identifier(server), 20)) {
             otOut << "Error: cannot reserve transaction numbers.\n";
             return -1;
@@ -244,17 +247,17 @@ int32_t CmdExchangeBasket::run(string myacct, string direction, string multiple)
     const Identifier theNotaryID{server}, theNymID{mynym}, theAcctID{myacct};
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .ExchangeBasketCurrency(
-                              theNymID,
-                              theNotaryID,
-                              Identifier(assetType),
-                              theAcctID,
-                              Identifier(basket),
-                              bExchangingIn)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .ExchangeBasketCurrency(
+                    theNymID,
+                    theNotaryID,
+                    Identifier(assetType),
+                    theAcctID,
+                    Identifier(basket),
+                    bExchangingIn));
     }
     int32_t reply =
         responseReply(response, server, mynym, myacct, "exchange_basket");
@@ -263,7 +266,7 @@ int32_t CmdExchangeBasket::run(string myacct, string direction, string multiple)
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
+        if (!downloadAccount(
                 theNymID, theNotaryID, theAcctID, true)) {
             otOut << "Error retrieving intermediary files for account.\n";
             return -1;
@@ -293,7 +296,7 @@ int32_t CmdExchangeBasket::showBasketAccounts(
 {
     const auto& storage = OT::App().DB();
     dashLine();
-    cout << " ** ACCOUNTS:\n\n";
+    out() << " ** ACCOUNTS:\n\n";
 
     for (const auto& it : storage.AccountList()) {
         const auto& acct = std::get<0>(it);
@@ -326,7 +329,7 @@ int32_t CmdExchangeBasket::showBasketAccounts(
                         return -1;
                     }
 
-                    cout << statAccount << "\n";
+                    out() << statAccount << "\n";
                 }
             }
         }
@@ -48,17 +48,20 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--mypurse <purse>",
+    "[--hisnym <nym>]",
+    "[--indices <indices|all>]",
+    "[--password <true|false>]"};
+}  // namespace
+
 CmdExportCash::CmdExportCash()
 {
-    command = "exportcash";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--mypurse <purse>";
-    args[3] = "[--hisnym <nym>]";
-    args[4] = "[--indices <indices|all>]";
-    args[5] = "[--password <true|false>]";
-    category = catInstruments;
-    help = "Export a cash purse.";
+    setArguments(arguments);
     usage = "When password-protected, --hisnym is ignored.\n"
             "Otherwise cash is exported to hisnym instead of mynym.";
 }
@@ -126,7 +129,7 @@ int32_t CmdExportCash::run(
         return -1;
     }
 
-    cout << purse << "\n";
+    out() << purse << "\n";
 
     return 1;
 }
@@ -183,14 +186,14 @@ string CmdExportCash::exportCash(
     if (!VerifyStringVal(strContract)) {
         std::string response;
         {
-            response = OT::App()
-                                      .API()
-                                      .ServerAction()
-                                      .DownloadContract(
-                                          Identifier(mynym),
-                                          Identifier(server),
-                                          Identifier(assetType))
-                                      ->Run();
+            response = notaryRun(
+                OT::App()
+                    .API()
+                    .ServerAction()
+                    .DownloadContract(
+                        Identifier(mynym),
+                        Identifier(server),
+                        Identifier(assetType)));
         }
 
         if (1 == VerifyMessageSuccess(response)) {
@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdExportNym::CmdExportNym()
 {
-    command = "exportnym";
-    args[0] = "--mynym <nym>";
-    category = catWallet;
-    help = "Export myym as a single importable file.";
+    setArguments(arguments);
 }
 
 CmdExportNym::~CmdExportNym() {}
@@ -71,6 +73,6 @@ int32_t CmdExportNym::run(string mynym)
         return -1;
     }
 
-    cout << exportedNym << "\n";
+    out() << exportedNym << "\n";
     return 1;
 }
@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--hisnym <nym>"};
+}  // namespace
+
 CmdFindNym::CmdFindNym()
 {
-    command = "findnym";
-    args[0] = "--hisnym <nym>";
-    category = catOtherUsers;
-    help = "Search all known servers for a nym.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdFindNym::runWithOptions() { return run(getOption("hisnym")); }
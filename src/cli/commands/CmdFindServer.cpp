@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--server <server id>"};
+}  // namespace
+
 CmdFindServer::CmdFindServer()
 {
-    command = "findserver";
-    args[0] = "--server <server id>";
-    category = catOtherUsers;
-    help = "Search all known servers for a server contract.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdFindServer::runWithOptions()
@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--hisnym <nymid>"};
+}  // namespace
+
 CmdGetContact::CmdGetContact()
 {
-    command = "getcontact";
-    args[0] = "--hisnym <nymid>";
-    category = catOtherUsers;
-    help = "Look up the contact ID for a nym ID";
+    setArguments(arguments);
 }
 
 std::int32_t CmdGetContact::runWithOptions()
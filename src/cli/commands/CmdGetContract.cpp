@@ -46,14 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--contract <contractid>"};
+}  // namespace
+
 CmdGetInstrumentDefinition::CmdGetInstrumentDefinition()
 {
-    command = "getcontract";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--contract <contractid>";
-    category = catAdmin;
-    help = "Download an asset or server contract by its ID.";
+    setArguments(arguments);
 }
 
 CmdGetInstrumentDefinition::~CmdGetInstrumentDefinition() {}
@@ -82,12 +85,14 @@ int32_t CmdGetInstrumentDefinition::run(
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .DownloadContract(
-                Identifier(mynym), Identifier(server), Identifier(contract))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadContract(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(contract)));
     }
     return processResponse(response, "retrieve contract");
 }
@@ -48,13 +48,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdGetMarkets::CmdGetMarkets()
 {
-    command = "getmarkets";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMarkets;
-    help = "Download mynym's list of markets.";
+    setArguments(arguments);
 }
 
 CmdGetMarkets::~CmdGetMarkets() {}
@@ -76,11 +77,11 @@ int32_t CmdGetMarkets::run(string server, string mynym)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .DownloadMarketList(Identifier(mynym), Identifier(server))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadMarketList(Identifier(mynym), Identifier(server)));
     }
     if (1 != responseStatus(response)) {
         otOut << "Error: cannot get market list.\n";
@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdGetMyOffers::CmdGetMyOffers()
 {
-    command = "getmyoffers";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMarkets;
-    help = "Download mynym's list of market offers.";
+    setArguments(arguments);
 }
 
 CmdGetMyOffers::~CmdGetMyOffers() {}
@@ -75,11 +76,12 @@ int32_t CmdGetMyOffers::run(string server, string mynym)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .DownloadNymMarketOffers(Identifier(mynym), Identifier(server))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadNymMarketOffers(
+                    Identifier(mynym), Identifier(server)));
     }
     if (1 != processResponse(response, "get market offers")) {
         return -1;
@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--market <marketid>",
+    "[--depth <depth>]"};
+}  // namespace
+
 CmdGetOffers::CmdGetOffers()
 {
-    command = "getoffers";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--market <marketid>";
-    args[3] = "[--depth <depth>]";
-    category = catMarkets;
-    help = "Download mynym's list of market offers.";
+    setArguments(arguments);
     usage = "Default depth is 50";
 }
 
@@ -94,15 +97,15 @@ int32_t CmdGetOffers::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .DownloadMarketOffers(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(market),
-                              stoll(depth))
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadMarketOffers(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(market),
+                    stoll(depth)));
     }
     if (1 != processResponse(response, "get market offers")) {
         return -1;
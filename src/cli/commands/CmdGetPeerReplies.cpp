@@ -43,12 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdGetPeerReplies::CmdGetPeerReplies()
 {
-    command = "getpeerreplies";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Get a list of incoming peer reply IDs";
+    setArguments(arguments);
 }
 
 CmdGetPeerReplies::~CmdGetPeerReplies() {}
@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--reply <reply ID>"};
+}  // namespace
+
 CmdGetPeerReply::CmdGetPeerReply()
 {
-    command = "getpeerreply";
-    args[0] = "--mynym <nym>";
-    args[1] = "--reply <reply ID>";
-    category = catOtherUsers;
-    help = "Show a base64-encoded peer reply";
+    setArguments(arguments);
 }
 
 std::int32_t CmdGetPeerReply::runWithOptions()
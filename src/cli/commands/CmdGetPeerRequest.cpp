@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--request <request ID>"};
+}  // namespace
+
 CmdGetPeerRequest::CmdGetPeerRequest()
 {
-    command = "getpeerrequest";
-    args[0] = "--mynym <nym>";
-    args[1] = "--request <request ID>";
-    category = catOtherUsers;
-    help = "Show a base64-encoded peer request";
+    setArguments(arguments);
 }
 
 std::int32_t CmdGetPeerRequest::runWithOptions()
@@ -43,12 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdGetPeerRequests::CmdGetPeerRequests()
 {
-    command = "getpeerrequests";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Get a list of incoming peer request IDs";
+    setArguments(arguments);
 }
 
 CmdGetPeerRequests::~CmdGetPeerRequests() {}
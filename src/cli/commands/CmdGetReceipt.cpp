@@ -49,16 +49,19 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "[--myacct <account>]",
+    "--id <transactionnr>",
+    "[--boxtype <0|1|2>]"};
+}  // namespace
+
 CmdGetReceipt::CmdGetReceipt()
 {
-    command = "getreceipt";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "[--myacct <account>]";
-    args[3] = "--id <transactionnr>";
-    args[4] = "[--boxtype <0|1|2>]";
-    category = catAdmin;
-    help = "Downloads a box receipt based on transaction nr.";
+    setArguments(arguments);
     usage = "Box types: 0 = NymBox, 1 = Inbox(default), 2 = Outbox.\n"
             "For Inbox and Outbox you need to specify --myacct";
 }
@@ -123,16 +126,16 @@ int32_t CmdGetReceipt::run(
     sscanf(id.c_str(), "%" SCNd64, &i);
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .DownloadBoxReceipt(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(myacct),
-                              RemoteBoxType(type),
-                              TransactionNumber(i))
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .DownloadBoxReceipt(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(myacct),
+                    RemoteBoxType(type),
+                    TransactionNumber(i)));
     }
     return processResponse(response, "get box receipt");
 }
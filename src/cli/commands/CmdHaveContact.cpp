@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--contact <nym or payment code>"};
+}  // namespace
+
 CmdHaveContact::CmdHaveContact()
 {
-    command = "havecontact";
-    args[0] = "--contact <nym or payment code>";
-    category = catOtherUsers;
-    help = "Determine if a contact exists";
+    setArguments(arguments);
 }
 
 std::int32_t CmdHaveContact::runWithOptions()
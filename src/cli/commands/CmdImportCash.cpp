@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"[--mynym <nym>]"};
+}  // namespace
+
 CmdImportCash::CmdImportCash()
 {
-    command = "importcash";
-    args[0] = "[--mynym <nym>]";
-    category = catInstruments;
-    help = "Import a pasted cash purse.";
+    setArguments(arguments);
     usage = "Specify mynym when a signer nym cannot be deduced.";
 }
 
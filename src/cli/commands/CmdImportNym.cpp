@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdImportNym::CmdImportNym()
-{
-    command = "importnym";
-    category = catWallet;
-    help = "Import a pasted nym.";
-}
+CmdImportNym::CmdImportNym() {}
 
 CmdImportNym::~CmdImportNym() {}
 
@@ -71,7 +66,7 @@ int32_t CmdImportNym::run()
         return -1;
     }
 
-    cout << "Imported nym: " << outNym << ".\n";
+    out() << "Imported nym: " << outNym << ".\n";
 
     return 1;
 }
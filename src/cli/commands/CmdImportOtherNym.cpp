@@ -45,12 +45,7 @@
 
 namespace opentxs
 {
-CmdImportOtherNym::CmdImportOtherNym()
-{
-    command = "importothernym";
-    category = catWallet;
-    help = "Import a pasted nym.";
-}
+CmdImportOtherNym::CmdImportOtherNym() {}
 
 std::int32_t CmdImportOtherNym::runWithOptions() { return run(); }
 
@@ -71,7 +66,7 @@ std::int32_t CmdImportOtherNym::run()
         return -1;
     }
 
-    std::cout << "Imported nym: " << outNym << ".\n";
+    out() << "Imported nym: " << outNym << ".\n";
 
     return 1;
 }
@@ -45,12 +45,7 @@
 namespace opentxs
 {
 
-CmdImportPublicNym::CmdImportPublicNym()
-{
-    command = "importpublicnym";
-    category = catWallet;
-    help = "Import a public nym.";
-}
+CmdImportPublicNym::CmdImportPublicNym() {}
 
 std::int32_t CmdImportPublicNym::runWithOptions() { return run(); }
 
@@ -46,13 +46,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--words <word list>", "[--phrase <passphrase>]"};
+}  // namespace
+
 CmdImportSeed::CmdImportSeed()
 {
-    command = "importseed";
-    args[0] = "--words <word list>";
-    args[1] = "[--phrase <passphrase>]";
-    category = catWallet;
-    help = "Add a BIP39 seed to the wallet";
+    setArguments(arguments);
 }
 
 int32_t CmdImportSeed::runWithOptions()
@@ -71,7 +72,7 @@ int32_t CmdImportSeed::run(const std::string& words, const std::string& phrase)
     const bool empty = fingerprint.empty();
 
     if (!empty) {
-        std::cout << fingerprint << std::endl;
+        out() << fingerprint << "\n";
     }
 
     return empty ? -1 : 0;
@@ -38,6 +38,8 @@
 
 #include "CmdInbox.hpp"
 
+#include "../LedgerSnapshot.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
@@ -47,19 +49,36 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+}  // namespace
+
 CmdInbox::CmdInbox()
 {
-    command = "inbox";
-    args[0] = "--myacct <account>";
-    category = catAccounts;
-    help = "Show myacct's inbox.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 CmdInbox::~CmdInbox() {}
 
-int32_t CmdInbox::runWithOptions() { return run(getOption("myacct")); }
+int32_t CmdInbox::runWithOptions()
+{
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
+
+    return run(getOption("myacct"), paging);
+}
 
-int32_t CmdInbox::run(string myacct)
+int32_t CmdInbox::run(string myacct, const Paging& paging)
 {
     if (!checkAccount("myacct", myacct)) {
         return -1;
@@ -77,69 +96,45 @@ int32_t CmdInbox::run(string myacct)
         return -1;
     }
 
-    string inbox = SwigWrap::LoadInbox(server, mynym, myacct);
-    if ("" == inbox) {
+    LedgerSnapshot inbox;
+    if (!inbox.load(
+            LedgerSnapshot::Box::Inbox, server, mynym, myacct, paging)) {
         otOut << "Error: cannot load inbox.\n";
         return -1;
     }
 
-    int32_t items = SwigWrap::Ledger_GetCount(server, mynym, myacct, inbox);
-    if (0 > items) {
-        otOut << "Error: cannot load inbox item count.\n";
-        return -1;
+    if (0 == inbox.size()) {
+        otOut << (0 == inbox.total ? "The inbox is empty.\n"
+                                   : "No inbox receipts in that range.\n");
+        return 0;
     }
 
-    if (0 == items) {
-        otOut << "The inbox is empty.\n";
-        return 0;
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Show inbox for an asset account  (" << myacct << "): \n"
+              << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
+              << "---------------------------------|(from or to)\n";
     }
 
-    cout << "Show inbox for an asset account  (" << myacct << "): \n"
-         << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
-         << "---------------------------------|(from or to)\n";
-
-    for (int32_t i = 0; i < items; i++) {
-        string tx = SwigWrap::Ledger_GetTransactionByIndex(
-            server, mynym, myacct, inbox, i);
-        int64_t txNum = SwigWrap::Ledger_GetTransactionIDByIndex(
-            server, mynym, myacct, inbox, i);
-        int64_t refNum = SwigWrap::Transaction_GetDisplayReferenceToNum(
-            server, mynym, myacct, tx);
-        int64_t amount =
-            SwigWrap::Transaction_GetAmount(server, mynym, myacct, tx);
-        string type = SwigWrap::Transaction_GetType(server, mynym, myacct, tx);
-        string senderUser =
-            SwigWrap::Transaction_GetSenderNymID(server, mynym, myacct, tx);
-        string senderAcct =
-            SwigWrap::Transaction_GetSenderAcctID(server, mynym, myacct, tx);
-        string recipientUser =
-            SwigWrap::Transaction_GetRecipientNymID(server, mynym, myacct, tx);
-        string recipientAcct =
-            SwigWrap::Transaction_GetRecipientAcctID(server, mynym, myacct, tx);
-
-        string user = "" != senderUser ? senderUser : recipientUser;
-        string acct = "" != senderAcct ? senderAcct : recipientAcct;
-
-        bool haveUser = "" != user;
-        bool haveAcct = "" != acct;
-
-        string separator = (haveUser || haveAcct)
-                               ? "\n                                 |"
-                               : "";
-        string userDenoter = haveUser ? "U:" : "";
-        string acctDenoter = haveAcct ? "A:" : "";
-        string assetType = haveAcct ? getAccountAssetType(acct) : "";
-
-        string fmtAmount = formatAmount(assetType, amount);
-
-        cout << i << "    ";
-        cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
-        cout << type << (type.size() > 10 ? " " : "    ");
-        cout << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
-        cout << refNum << (to_string(refNum).size() > 2 ? "  " : " ") << "|";
-        cout << userDenoter << user << separator << acctDenoter << acct << "\n";
+    for (size_t i = 0; i < inbox.size(); i++) {
+        if (rows) {
+            JsonRow row(out());
+            row.field("index", static_cast<int64_t>(inbox.position[i]))
+                .field("date", inbox.date[i])
+                .field("amount", inbox.amount[i])
+                .field("type", inbox.type[i])
+                .field("transaction", inbox.number[i])
+                .field("in_reference_to", inbox.reference[i])
+                .field("user", inbox.user(i))
+                .field("account", inbox.account(i));
+            continue;
+        }
+
+        receiptLine(inbox, i, inbox.user(i), inbox.account(i));
     }
 
+    if (rows) { return 1; }
+
     otOut << "\n For the above, try: accepttransfers, acceptreceipts, "
              "acceptinbox, acceptmoney, or acceptall.\n";
 
@@ -144,7 +144,7 @@ public:
     EXPORT CmdInbox();
     virtual ~CmdInbox();
 
-    EXPORT int32_t run(std::string myacct);
+    EXPORT int32_t run(std::string myacct, const Paging& paging = Paging());
 
 protected:
     virtual int32_t runWithOptions();
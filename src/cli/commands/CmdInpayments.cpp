@@ -38,6 +38,8 @@
 
 #include "CmdInpayments.hpp"
 
+#include "../LedgerSnapshot.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
@@ -47,13 +49,15 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdInpayments::CmdInpayments()
 {
-    command = "inpayments";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Show mynym's incoming payments box.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 CmdInpayments::~CmdInpayments() {}
@@ -73,56 +77,42 @@ int32_t CmdInpayments::run(string server, string mynym)
         return -1;
     }
 
-    string inbox = SwigWrap::LoadPaymentInbox(server, mynym);
-    if ("" == inbox) {
+    LedgerSnapshot inbox;
+    if (!inbox.load(LedgerSnapshot::Box::PaymentInbox, server, mynym, mynym)) {
         otOut << "Error: cannot load payment inbox.\n";
         return -1;
     }
 
-    int32_t items = SwigWrap::Ledger_GetCount(server, mynym, mynym, inbox);
-    if (0 > items) {
-        otOut << "Error: cannot load payment inbox item count.\n";
-        return -1;
-    }
-
-    if (0 == items) {
+    if (0 == inbox.size()) {
         otOut << "The payment inbox is empty.\n";
         return 0;
     }
 
-    cout << "Show payments inbox (Nym/Server)\n( " << mynym << " / " << server
-         << " )\n";
-    cout << "Idx  Amt   Type      Txn#  Asset_Type\n";
-    cout << "---------------------------------------\n";
-
-    for (int32_t i = 0; i < items; i++) {
-        string payment =
-            SwigWrap::Ledger_GetInstrument(server, mynym, mynym, inbox, i);
-        if ("" == payment) {
-            otOut << "Error: cannot load payment.\n";
-            return -1;
-        }
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Show payments inbox (Nym/Server)\n( " << mynym << " / "
+              << server << " )\n";
+        out() << "Idx  Amt   Type      Txn#  Asset_Type\n";
+        out() << "---------------------------------------\n";
+    }
 
-        string tx = SwigWrap::Ledger_GetTransactionByIndex(
-            server, mynym, mynym, inbox, i);
-        int64_t txNum = SwigWrap::Ledger_GetTransactionIDByIndex(
-            server, mynym, mynym, inbox, i);
-        /* int64_t refNum = */ SwigWrap::Transaction_GetDisplayReferenceToNum(
-            server, mynym, mynym, tx);
-        int64_t amount = SwigWrap::Instrmnt_GetAmount(payment);
-        string type = SwigWrap::Instrmnt_GetType(payment);
-        string assetType =
-            SwigWrap::Instrmnt_GetInstrumentDefinitionID(payment);
-        string senderUser = SwigWrap::Instrmnt_GetSenderNymID(payment);
-        string senderAcct = SwigWrap::Instrmnt_GetSenderAcctID(payment);
-        string recipientUser = SwigWrap::Instrmnt_GetRecipientNymID(payment);
-        string recipientAcct = SwigWrap::Instrmnt_GetRecipientAcctID(payment);
-
-        string user = "" != senderUser ? senderUser : recipientUser;
-        string acct = "" != senderAcct ? senderAcct : recipientAcct;
-
-        string fmtAmount = formatAmount(assetType, amount);
+    for (size_t i = 0; i < inbox.size(); i++) {
+        const string& type = inbox.type[i];
+        const string& assetType = inbox.unit[i];
+
+        if (rows) {
+            JsonRow row(out());
+            row.field("index", static_cast<int64_t>(inbox.position[i]))
+                .field("date", inbox.date[i])
+                .field("amount", inbox.amount[i])
+                .field("type", type)
+                .field("transaction", inbox.number[i])
+                .field("unit", assetType);
+            continue;
+        }
 
+        string fmtAmount = formatAmount(assetType, inbox.amount[i]);
+        int64_t txNum = inbox.number[i];
         string txID = 0 <= txNum ? to_string(txNum) : "UNKNOWN_TRANS_NUM";
 
         string assetName = "";
@@ -130,13 +120,15 @@ int32_t CmdInpayments::run(string server, string mynym)
             assetName = " - \"" + SwigWrap::GetAssetType_Name(assetType) + "\"";
         }
 
-        cout << i << "    ";
-        cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
-        cout << type << (type.size() > 10 ? " " : "    ");
-        cout << txID << (txID.size() < 2 ? "    " : "   ");
-        cout << assetType << assetName << "\n";
+        out() << i << "    ";
+        out() << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
+        out() << type << (type.size() > 10 ? " " : "    ");
+        out() << txID << (txID.size() < 2 ? "    " : "   ");
+        out() << assetType << assetName << "\n";
     }
 
+    if (rows) { return 1; }
+
     otOut << "\nFor the above, try: acceptpayments, acceptinvoices, "
              "acceptmoney, or acceptall.\nEXCEPT for smart contracts and "
              "payment plans -- for those, use: opentxs confirm\n\n";
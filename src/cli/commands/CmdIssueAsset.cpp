@@ -46,14 +46,17 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--mypurse <unit definition id>"};
+}  // namespace
+
 CmdIssueAsset::CmdIssueAsset()
 {
-    command = "issueasset";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--mypurse <unit definition id>";
-    category = catAdmin;
-    help = "Issue a currency contract onto an OT server.";
+    setArguments(arguments);
     usage = "Mynym must already be the contract key on the new contract.";
 }
 
@@ -87,14 +90,14 @@ int32_t CmdIssueAsset::run(std::string server, std::string mynym, std::string my
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .IssueUnitDefinition(
-                              Identifier(mynym),
-                              Identifier(server),
-                              contract->PublicContract())
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .IssueUnitDefinition(
+                    Identifier(mynym),
+                    Identifier(server),
+                    contract->PublicContract()));
     }
     return processResponse(response, "issue asset contract");
 }
@@ -48,15 +48,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--myacct <account>",
+    "--id <transactionnr>"};
+}  // namespace
+
 CmdKillOffer::CmdKillOffer()
 {
-    command = "killoffer";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--myacct <account>";
-    args[3] = "--id <transactionnr>";
-    category = catMarkets;
-    help = "Kill an active market offer.";
+    setArguments(arguments);
 }
 
 CmdKillOffer::~CmdKillOffer() {}
@@ -92,12 +95,15 @@ int32_t CmdKillOffer::run(string server, string mynym, string myacct, string id)
     sscanf(id.c_str(), "%" SCNd64, &i);
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .KillMarketOffer(
-                Identifier(mynym), Identifier(server), Identifier(myacct), i)
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .KillMarketOffer(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(myacct),
+                    i));
     }
     return processTxResponse(
         server, mynym, myacct, response, "kill market offer");
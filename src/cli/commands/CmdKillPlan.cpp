@@ -48,15 +48,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--myacct <account>",
+    "--id <transactionnr>"};
+}  // namespace
+
 CmdKillPlan::CmdKillPlan()
 {
-    command = "killplan";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--myacct <account>";
-    args[3] = "--id <transactionnr>";
-    category = catInstruments;
-    help = "Kill an active payment plan.";
+    setArguments(arguments);
 }
 
 CmdKillPlan::~CmdKillPlan() {}
@@ -88,12 +91,15 @@ int32_t CmdKillPlan::run(string server, string mynym, string myacct, string id)
     sscanf(id.c_str(), "%" SCNd64, &i);
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .KillPaymentPlan(
-                Identifier(mynym), Identifier(server), Identifier(myacct), i)
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .KillPaymentPlan(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(myacct),
+                    i));
     }
     return processTxResponse(
         server, mynym, myacct, response, "kill payment plan");
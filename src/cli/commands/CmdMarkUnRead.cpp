@@ -42,14 +42,17 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--thread <threadID>",
+    "--item <itemID>"};
+}  // namespace
+
 CmdMarkUnRead::CmdMarkUnRead()
 {
-    command = "markunread";
-    args[0] = "--mynym <nym>";
-    args[1] = "--thread <threadID>";
-    args[2] = "--item <itemID>";
-    category = catOtherUsers;
-    help = "Mark a thread item as unread.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdMarkUnRead::runWithOptions()
@@ -42,13 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--id <id>", "--into <id>"};
+}  // namespace
+
 CmdMergeContact::CmdMergeContact()
 {
-    command = "mergecontact";
-    args[0] = "--id <id>";
-    args[1] = "--into <id>";
-    category = catOtherUsers;
-    help = "Merge two contacts";
+    setArguments(arguments);
 }
 
 std::int32_t CmdMergeContact::runWithOptions()
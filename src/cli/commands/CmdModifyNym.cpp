@@ -42,19 +42,22 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--individual <label>",
+    "--server <label>",
+    "--opentxs <server id>",
+    "--core <payment code>",
+    "--testcore <payment code>",
+    "--cash <payment code>",
+    "--testcash <payment code>"};
+}  // namespace
+
 CmdModifyNym::CmdModifyNym()
 {
-    command = "modifynym";
-    args[0] = "--mynym <nym>";
-    args[1] = "--individual <label>";
-    args[2] = "--server <label>";
-    args[3] = "--opentxs <server id>";
-    args[4] = "--core <payment code>";
-    args[5] = "--testcore <payment code>";
-    args[6] = "--cash <payment code>";
-    args[7] = "--testcash <payment code>";
-    category = catWallet;
-    help = "Edit a nym's contact credential data.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdModifyNym::runWithOptions()
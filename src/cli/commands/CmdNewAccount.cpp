@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--mypurse <purse>"};
+}  // namespace
+
 CmdNewAccount::CmdNewAccount()
 {
-    command = "newaccount";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--mypurse <purse>";
-    category = catAccounts;
-    help = "Create a new asset account.";
+    setArguments(arguments);
 }
 
 CmdNewAccount::~CmdNewAccount() {}
@@ -85,12 +88,14 @@ int32_t CmdNewAccount::run(string server, string mynym, string mypurse)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .RegisterAccount(
-                Identifier(mynym), Identifier(server), Identifier(mypurse))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .RegisterAccount(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(mypurse)));
     }
     return processResponse(response, "create asset account");
 }
@@ -47,18 +47,21 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--name <unit name>",
+    "--shortname <currency description>",
+    "--symbol <unit symbol>",
+    "--tla <unit three-leter acronym>",
+    "--power <decimal power>",
+    "--fraction <unit fraction name>"};
+}  // namespace
+
 CmdNewAsset::CmdNewAsset()
 {
-    command = "newasset";
-    args[0] = "--mynym <nym>";
-    args[1] = "--name <unit name>";
-    args[2] = "--shortname <currency description>";
-    args[3] = "--symbol <unit symbol>";
-    args[4] = "--tla <unit three-leter acronym>";
-    args[5] = "--power <decimal power>";
-    args[6] = "--fraction <unit fraction name>";
-    category = catAdmin;
-    help = "Create a new currency contract.";
+    setArguments(arguments);
 }
 
 CmdNewAsset::~CmdNewAsset() {}
@@ -101,7 +104,7 @@ int32_t CmdNewAsset::run(
         return -1;
     }
 
-    cout << "New instrument definition ID : " << unitDefinitionID << std::endl;
+    out() << "New instrument definition ID : " << unitDefinitionID << "\n";
 
     string contract = SwigWrap::GetAssetType_Contract(unitDefinitionID);
     if ("" == contract) {
@@ -109,7 +112,7 @@ int32_t CmdNewAsset::run(
         return -1;
     }
 
-    cout << contract << std::endl;
+    out() << contract << "\n";
 
     return 1;
 }
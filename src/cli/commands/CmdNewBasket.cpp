@@ -48,18 +48,21 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--assets <number of currencies in the basket>",
+    "--shortname <currency description>",
+    "--name <unit name>",
+    "--symbol <unit symbol>",
+    "--weight <minTransfer>"};
+}  // namespace
+
 CmdNewBasket::CmdNewBasket()
 {
-    command = "newbasket";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--assets <number of currencies in the basket>";
-    args[3] = "--shortname <currency description>";
-    args[4] = "--name <unit name>";
-    args[5] = "--symbol <unit symbol>";
-    args[6] = "--weight <minTransfer>";
-    category = catBaskets;
-    help = "Create a new basket currency.";
+    setArguments(arguments);
 }
 
 CmdNewBasket::~CmdNewBasket() {}
@@ -160,7 +163,7 @@ int32_t CmdNewBasket::run(
         minTransfer = 100;
         string minAmount = inputLine();
         if ("" != minAmount) {
-            minTransfer = SwigWrap::StringToAmount(assetType, minAmount);
+            minTransfer = parseAmount(assetType, minAmount);
             if (1 > minTransfer) {
                 otOut << "Error: invalid minimum transfer amount." << std::endl;
                 i--;
@@ -181,22 +184,22 @@ int32_t CmdNewBasket::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .IssueBasketCurrency(
-                              Identifier(mynym),
-                              Identifier(server),
-                              proto::StringToProto<proto::UnitDefinition>(
-                                  String(basket.c_str())))
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .IssueBasketCurrency(
+                    Identifier(mynym),
+                    Identifier(server),
+                    proto::StringToProto<proto::UnitDefinition>(
+                        String(basket.c_str()))));
     }
     int32_t status = responseStatus(response);
     switch (status) {
         case 1: {
             otOut << "\n\n SUCCESS in issue_basket_currency! Server "
                      "response:\n\n";
-            cout << response << "\n";
+            out() << response << "\n";
 
             string strNewID =
                 SwigWrap::Message_GetNewInstrumentDefinitionID(response);
@@ -206,14 +209,14 @@ int32_t CmdNewBasket::run(
 
             if (bGotNewID) {
                 {
-                    response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .DownloadContract(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(strNewID))
-                               ->Run();
+                    response = notaryRun(
+                        OT::App()
+                            .API()
+                            .ServerAction()
+                            .DownloadContract(
+                                Identifier(mynym),
+                                Identifier(server),
+                                Identifier(strNewID)));
                 }
                 strEnding = ": " + strNewID;
 
@@ -229,7 +232,7 @@ int32_t CmdNewBasket::run(
         case 0:
             otOut << "\n\n FAILURE in issue_basket_currency! Server "
                      "response:\n\n";
-            cout << response << "\n";
+            out() << response << "\n";
             otOut << " FAILURE in issue_basket_currency!\n";
             break;
         default:
@@ -238,7 +241,7 @@ int32_t CmdNewBasket::run(
 
             if ("" != response) {
                 otOut << "Server response:\n\n";
-                cout << response << "\n";
+                out() << response << "\n";
                 otOut << "\nError in issue_basket_currency! status is: "
                       << status << "\n";
             }
@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdNewKey::CmdNewKey()
-{
-    command = "newkey";
-    category = catAdmin;
-    help = "Create a new symmetric key.";
-}
+CmdNewKey::CmdNewKey() {}
 
 CmdNewKey::~CmdNewKey() {}
 
@@ -66,7 +61,7 @@ int32_t CmdNewKey::run()
         return -1;
     }
 
-    cout << key << "\n";
+    out() << key << "\n";
 
     return 1;
 }
@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--label <label>",
+    "[--source <seed fingerprint>]",
+    "[--index <HD derivation path>]"};
+}  // namespace
+
 CmdNewNymHD::CmdNewNymHD()
 {
-    command = "newnymhd";
-    args[0] = "--label <label>";
-    args[1] = "[--source <seed fingerprint>]";
-    args[2] = "[--index <HD derivation path>]";
-    category = catNyms;
-    help = "create a new nym using HD key derivation.";
+    setArguments(arguments);
 }
 
 int32_t CmdNewNymHD::runWithOptions()
@@ -92,7 +95,7 @@ int32_t CmdNewNymHD::run(string label, string source, string path)
         return -1;
     }
 
-    cout << "New nym: " << mynym << "\n";
+    out() << "New nym: " << mynym << "\n";
 
     return 1;
 }
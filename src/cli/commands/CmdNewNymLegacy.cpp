@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--label <label>",
+    "[--keybits <1024|2048|4096|8192>]",
+    "[--source <source>]",
+    "[--location <location>]"};
+}  // namespace
+
 CmdNewNymLegacy::CmdNewNymLegacy()
 {
-    command = "newnymlegacy";
-    args[0] = "--label <label>";
-    args[1] = "[--keybits <1024|2048|4096|8192>]";
-    args[2] = "[--source <source>]";
-    args[3] = "[--location <location>]";
-    category = catNyms;
-    help = "create a new OpenSSL-based RSA nym.";
+    setArguments(arguments);
 }
 
 CmdNewNymLegacy::~CmdNewNymLegacy() {}
@@ -99,7 +102,7 @@ int32_t CmdNewNymLegacy::run(string keybits, string label, string source)
         return -1;
     }
 
-    cout << "New nym: " << mynym << "\n";
+    out() << "New nym: " << mynym << "\n";
 
     if (!SwigWrap::SetNym_Alias(mynym, mynym, label)) {
         otOut << "Error: cannot set new nym name.\n";
@@ -50,20 +50,23 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <assetaccount>",
+    "--hisacct <currencyaccount>",
+    "--type <ask|bid>",
+    "--scale <1|10|100|...>",
+    "--mininc <min increment>",
+    "--quantity <quantity>",
+    "--price <price>",
+    "[--lifespan <seconds> (default 86400 (1 day))]"};
+}  // namespace
+
 CmdNewOffer::CmdNewOffer()
 {
-    command = "newoffer";
     // FIX more arguments
-    args[0] = "--myacct <assetaccount>";
-    args[1] = "--hisacct <currencyaccount>";
-    args[2] = "--type <ask|bid>";
-    args[3] = "--scale <1|10|100|...>";
-    args[4] = "--mininc <min increment>";
-    args[5] = "--quantity <quantity>";
-    args[6] = "--price <price>";
-    args[7] = "[--lifespan <seconds> (default 86400 (1 day))]";
-    category = catMarkets;
-    help = "Create a new market offer.";
+    setArguments(arguments);
     usage = "A price of 0 means a market order at any price.";
 }
 
@@ -176,21 +179,21 @@ int32_t CmdNewOffer::run(
     sscanf(lifespan.c_str(), "%" SCNd64, &l);
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .CreateMarketOffer(
-                              Identifier(myacct),
-                              Identifier(hisacct),
-                              Amount(s),
-                              Amount(m),
-                              Amount(q),
-                              Amount(p),
-                              type == "ask",
-                              std::chrono::seconds(l),
-                              "",
-                              Amount(0))
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .CreateMarketOffer(
+                    Identifier(myacct),
+                    Identifier(hisacct),
+                    Amount(s),
+                    Amount(m),
+                    Amount(q),
+                    Amount(p),
+                    type == "ask",
+                    std::chrono::seconds(l),
+                    "",
+                    Amount(0)));
     }
     return responseReply(
         response, server, mynym, myacct, "create_market_offer");
@@ -299,15 +302,15 @@ int32_t CmdNewOffer::cleanMarketOfferList(
         sscanf(id.c_str(), "%" SCNd64, &j);
         std::string response;
         {
-            response = OT::App()
-                              .API()
-                              .ServerAction()
-                              .KillMarketOffer(
-                                  Identifier(mynym),
-                                  Identifier(server),
-                                  Identifier(myacct),
-                                  j)
-                              ->Run();
+            response = notaryRun(
+                OT::App()
+                    .API()
+                    .ServerAction()
+                    .KillMarketOffer(
+                        Identifier(mynym),
+                        Identifier(server),
+                        Identifier(myacct),
+                        j));
         }
         if (0 > processTxResponse(
                     server, mynym, myacct, response, "kill market offer")) {
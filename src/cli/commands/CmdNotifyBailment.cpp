@@ -43,17 +43,20 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse <unit definition id>",
+    "--request <request ID>",
+    "--amount <amount>"};
+}  // namespace
+
 CmdNotifyBailment::CmdNotifyBailment()
 {
-    command = "notifybailment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse <unit definition id>";
-    args[4] = "--request <request ID>";
-    args[5] = "--amount <amount>";
-    category = catOtherUsers;
-    help = "Notify a nym of a pending blockchain deposit";
+    setArguments(arguments);
 }
 
 CmdNotifyBailment::~CmdNotifyBailment() {}
@@ -97,13 +100,12 @@ std::int32_t CmdNotifyBailment::run(
         return -1;
     }
 
-    std::int64_t notifybailmentAmount =
-        SwigWrap::StringToAmount(mypurse, amount);
+    std::int64_t notifybailmentAmount = parseAmount(mypurse, amount);
     if (OT_ERROR_AMOUNT == notifybailmentAmount) {
         return -1;
     }
 
-    std::string txid = inputText("Blockchain transaction ID");
+    std::string txid = inputValue("Blockchain transaction ID");
 
     if (0 == txid.size()) {
         return -1;
@@ -111,18 +113,18 @@ std::int32_t CmdNotifyBailment::run(
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .NotifyBailment(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse),
-                                   Identifier(request),
-                                   txid,
-                                   notifybailmentAmount)
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .NotifyBailment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    Identifier(request),
+                    txid,
+                    notifybailmentAmount));
     }
     return processResponse(response, "notify bailment");
 }
@@ -38,6 +38,8 @@
 
 #include "CmdOutbox.hpp"
 
+#include "../LedgerSnapshot.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
@@ -47,19 +49,36 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+}  // namespace
+
 CmdOutbox::CmdOutbox()
 {
-    command = "outbox";
-    args[0] = "--myacct <account>";
-    category = catAccounts;
-    help = "Show myacct's outbox.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 CmdOutbox::~CmdOutbox() {}
 
-int32_t CmdOutbox::runWithOptions() { return run(getOption("myacct")); }
+int32_t CmdOutbox::runWithOptions()
+{
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
 
-int32_t CmdOutbox::run(string myacct)
+    return run(getOption("myacct"), paging);
+}
+
+int32_t CmdOutbox::run(string myacct, const Paging& paging)
 {
     if (!checkAccount("myacct", myacct)) {
         return -1;
@@ -77,67 +96,42 @@ int32_t CmdOutbox::run(string myacct)
         return -1;
     }
 
-    string outbox = SwigWrap::LoadOutbox(server, mynym, myacct);
-    if ("" == outbox) {
+    LedgerSnapshot outbox;
+    if (!outbox.load(
+            LedgerSnapshot::Box::Outbox, server, mynym, myacct, paging)) {
         otOut << "Error: cannot load outbox.\n";
         return -1;
     }
 
-    int32_t items = SwigWrap::Ledger_GetCount(server, mynym, myacct, outbox);
-    if (0 > items) {
-        otOut << "Error: cannot load outbox item count.\n";
-        return -1;
+    if (0 == outbox.size()) {
+        otOut << (0 == outbox.total ? "The outbox is empty.\n"
+                                    : "No outbox receipts in that range.\n");
+        return 0;
     }
 
-    if (0 == items) {
-        otOut << "The outbox is empty.\n";
-        return 0;
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Show outbox for an asset account  (" << myacct << "): \n"
+              << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
+              << "---------------------------------|(from or to)\n";
     }
 
-    cout << "Show outbox for an asset account  (" << myacct << "): \n"
-         << "Idx  Amt  Type        Txn# InRef#|User / Acct\n"
-         << "---------------------------------|(from or to)\n";
-
-    for (int32_t i = 0; i < items; i++) {
-        string tx = SwigWrap::Ledger_GetTransactionByIndex(
-            server, mynym, myacct, outbox, i);
-        int64_t txNum = SwigWrap::Ledger_GetTransactionIDByIndex(
-            server, mynym, myacct, outbox, i);
-        int64_t refNum = SwigWrap::Transaction_GetDisplayReferenceToNum(
-            server, mynym, myacct, tx);
-        int64_t amount =
-            SwigWrap::Transaction_GetAmount(server, mynym, myacct, tx);
-        string type = SwigWrap::Transaction_GetType(server, mynym, myacct, tx);
-        string senderUser =
-            SwigWrap::Transaction_GetSenderNymID(server, mynym, myacct, tx);
-        string senderAcct =
-            SwigWrap::Transaction_GetSenderAcctID(server, mynym, myacct, tx);
-        string recipientUser =
-            SwigWrap::Transaction_GetRecipientNymID(server, mynym, myacct, tx);
-        string recipientAcct =
-            SwigWrap::Transaction_GetRecipientAcctID(server, mynym, myacct, tx);
-
-        string user = recipientUser;
-        string acct = recipientAcct;
-
-        bool haveUser = "" != user;
-        bool haveAcct = "" != acct;
-
-        string separator = (haveUser || haveAcct)
-                               ? "\n                                 |"
-                               : "";
-        string userDenoter = haveUser ? "U:" : "";
-        string acctDenoter = haveAcct ? "A:" : "";
-        string assetType = haveAcct ? getAccountAssetType(acct) : "";
-
-        string fmtAmount = formatAmount(assetType, amount);
-
-        cout << i << "    ";
-        cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
-        cout << type << (type.size() > 10 ? " " : "    ");
-        cout << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
-        cout << refNum << (to_string(refNum).size() > 2 ? "  " : " ") << "|";
-        cout << userDenoter << user << separator << acctDenoter << acct << "\n";
+    for (size_t i = 0; i < outbox.size(); i++) {
+        if (rows) {
+            JsonRow row(out());
+            row.field("index", static_cast<int64_t>(outbox.position[i]))
+                .field("date", outbox.date[i])
+                .field("amount", outbox.amount[i])
+                .field("type", outbox.type[i])
+                .field("transaction", outbox.number[i])
+                .field("in_reference_to", outbox.reference[i])
+                .field("user", outbox.recipientNym[i])
+                .field("account", outbox.recipientAccount[i]);
+            continue;
+        }
+
+        receiptLine(
+            outbox, i, outbox.recipientNym[i], outbox.recipientAccount[i]);
     }
 
     return 1;
@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "[--index <index>]"};
+}  // namespace
+
 CmdOutpayment::CmdOutpayment()
 {
-    command = "outpayment";
-    args[0] = "--mynym <nym>";
-    args[1] = "[--index <index>]";
-    category = catOtherUsers;
-    help = "Show mynym's outgoing payments box.";
+    setArguments(arguments);
     usage = "Omitting --index shows all outpayments.";
 }
 
@@ -83,7 +84,7 @@ int32_t CmdOutpayment::run(string mynym, string index)
 
     // all items?
     if ("" == index) {
-        cout << "Payment outbox contents:\n\n";
+        out() << "Payment outbox contents:\n\n";
 
         int32_t retVal = 1;
         for (int32_t i = 0; i < items; i++) {
@@ -123,9 +124,9 @@ bool CmdOutpayment::showOutpayment(
     dashLine();
 
     if (!SwigWrap::Nym_VerifyOutpaymentsByIndex(mynym, index)) {
-        cout << "UNVERIFIED outpayment message " << index << ".\n";
+        out() << "UNVERIFIED outpayment message " << index << ".\n";
     } else {
-        cout << "Verified outpayment message " << index << "\n";
+        out() << "Verified outpayment message " << index << "\n";
     }
 
     string server = SwigWrap::GetNym_OutpaymentsNotaryIDByIndex(mynym, index);
@@ -136,40 +137,40 @@ bool CmdOutpayment::showOutpayment(
         SwigWrap::Instrmnt_GetInstrumentDefinitionID(payment);
     string type = SwigWrap::Instrmnt_GetType(payment);
 
-    cout << "         Amount: ";
+    out() << "         Amount: ";
     if (OT_ERROR_AMOUNT == amount) {
-        cout << "UNKNOWN_PAYMENT_AMOUNT\n";
+        out() << "UNKNOWN_PAYMENT_AMOUNT\n";
     } else {
-        cout << amount;
+        out() << amount;
         if ("" == type) {
             type = "UNKNOWN_PAYMENT_TYPE";
         }
-        cout << "  (" << type << ": "
-             << SwigWrap::FormatAmount(instrumentDefinitionID, amount) << ")";
-        cout << "\n";
+        out() << "  (" << type << ": "
+              << formatAmount(instrumentDefinitionID, amount) << ")";
+        out() << "\n";
     }
 
-    cout << "  Of instrument definition: " << instrumentDefinitionID;
+    out() << "  Of instrument definition: " << instrumentDefinitionID;
     if ("" != instrumentDefinitionID) {
-        cout << " \"" << SwigWrap::GetAssetType_Name(instrumentDefinitionID)
-             << "\"";
+        out() << " \"" << SwigWrap::GetAssetType_Name(instrumentDefinitionID)
+              << "\"";
     }
-    cout << "\n";
+    out() << "\n";
 
     if ("" != recipient) {
-        cout << "Payment sent to: " << recipient;
-        cout << " \"" << SwigWrap::GetNym_Name(recipient) << "\" ";
+        out() << "Payment sent to: " << recipient;
+        out() << " \"" << SwigWrap::GetNym_Name(recipient) << "\" ";
     }
-    cout << "\n";
+    out() << "\n";
 
     if ("" != server) {
-        cout << "   At server ID: " << server;
-        cout << " \"" << SwigWrap::GetServer_Name(server) << "\" ";
+        out() << "   At server ID: " << server;
+        out() << " \"" << SwigWrap::GetServer_Name(server) << "\" ";
     }
-    cout << "\n";
+    out() << "\n";
 
     if (showMessage) {
-        cout << "     Instrument: \n" << payment << "\n";
+        out() << "     Instrument: \n" << payment << "\n";
     }
 
     return true;
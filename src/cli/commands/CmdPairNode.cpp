@@ -43,14 +43,17 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--hisnym <bridge nym>",
+    "--password <server password>"};
+}  // namespace
+
 CmdPairNode::CmdPairNode()
 {
-    command = "pairnode";
-    args[0] = "--mynym <nym>";
-    args[1] = "--hisnym <bridge nym>";
-    args[2] = "--password <server password>";
-    category = catMisc;
-    help = "Pair with a Stash Node";
+    setArguments(arguments);
 }
 
 std::int32_t CmdPairNode::runWithOptions()
@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym ID>", "--issuer <issuer nym ID>"};
+}  // namespace
+
 CmdPairStatus::CmdPairStatus()
 {
-    command = "pairstatus";
-    args[0] = "--mynym <nym ID>";
-    args[1] = "--issuer <issuer nym ID>";
-    category = catMisc;
-    help = "Pairing status";
+    setArguments(arguments);
 }
 
 std::int32_t CmdPairStatus::runWithOptions()
@@ -66,7 +67,7 @@ std::int32_t CmdPairStatus::run(
         return -1;
     }
 
-    std::cout << SwigWrap::Pair_Status(localNym, issuerNym);
+    out() << SwigWrap::Pair_Status(localNym, issuerNym);
 
     return 1;
 }
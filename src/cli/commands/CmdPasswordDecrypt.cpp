@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdPasswordDecrypt::CmdPasswordDecrypt()
-{
-    command = "passworddecrypt";
-    category = catAdmin;
-    help = "Password-decrypt a ciphertext using a symmetric key.";
-}
+CmdPasswordDecrypt::CmdPasswordDecrypt() {}
 
 CmdPasswordDecrypt::~CmdPasswordDecrypt() {}
 
@@ -60,7 +55,7 @@ int32_t CmdPasswordDecrypt::runWithOptions() { return run(); }
 
 int32_t CmdPasswordDecrypt::run()
 {
-    string key = inputText("a symmetric key");
+    string key = inputValue("a symmetric key");
     if ("" == key) {
         return -1;
     }
@@ -76,7 +71,7 @@ int32_t CmdPasswordDecrypt::run()
         return -1;
     }
 
-    cout << encrypted << "\n";
+    out() << encrypted << "\n";
 
     return 1;
 }
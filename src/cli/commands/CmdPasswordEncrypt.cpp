@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdPasswordEncrypt::CmdPasswordEncrypt()
-{
-    command = "passwordencrypt";
-    category = catAdmin;
-    help = "Password-encrypt a plaintext using a symmetric key.";
-}
+CmdPasswordEncrypt::CmdPasswordEncrypt() {}
 
 CmdPasswordEncrypt::~CmdPasswordEncrypt() {}
 
@@ -60,7 +55,7 @@ int32_t CmdPasswordEncrypt::runWithOptions() { return run(); }
 
 int32_t CmdPasswordEncrypt::run()
 {
-    string key = inputText("a symmetric key");
+    string key = inputValue("a symmetric key");
     if ("" == key) {
         return -1;
     }
@@ -76,7 +71,7 @@ int32_t CmdPasswordEncrypt::run()
         return -1;
     }
 
-    cout << encrypted << "\n";
+    out() << encrypted << "\n";
 
     return 1;
 }
@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "--hispurse <purse>",
+    "--amount <pershare>",
+    "[--memo <memoline>]"};
+}  // namespace
+
 CmdPayDividend::CmdPayDividend()
 {
-    command = "paydividend";
-    args[0] = "--myacct <account>";
-    args[1] = "--hispurse <purse>";
-    args[2] = "--amount <pershare>";
-    args[3] = "[--memo <memoline>]";
-    category = catMarkets;
-    help = "Send dividend payout to all shareholders (in voucher form).";
+    setArguments(arguments);
 }
 
 CmdPayDividend::~CmdPayDividend() {}
@@ -107,17 +110,17 @@ int32_t CmdPayDividend::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .PayDividend(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(hispurse),
-                              Identifier(myacct),
-                              memo,
-                              value)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .PayDividend(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hispurse),
+                    Identifier(myacct),
+                    memo,
+                    value));
     }
     int32_t reply =
         responseReply(response, server, mynym, myacct, "pay_dividend");
@@ -126,8 +129,11 @@ int32_t CmdPayDividend::run(
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
-                Identifier(mynym), Identifier(server), Identifier(myacct), true)) {
+        if (!downloadAccount(
+                Identifier(mynym),
+                Identifier(server),
+                Identifier(myacct),
+                true)) {
             otOut << "Error retrieving intermediary files for account.\n";
             return -1;
         }
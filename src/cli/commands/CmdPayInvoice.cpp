@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--server <server>]",
+    "[--index <index>]"};
+}  // namespace
+
 CmdPayInvoice::CmdPayInvoice()
 {
-    command = "payinvoice";
-    args[0] = "--myacct <account>";
-    args[1] = "[--server <server>]";
-    args[2] = "[--index <index>]";
-    category = catOtherUsers;
-    help = "Pay an invoice.";
+    setArguments(arguments);
     usage = "If --index is omitted you must paste an invoice. Also, 'server' "
     "should be the 'transport notary' aka where myacct's Nym receives "
     "messages/payments. Default Server will be myacct's Notary ID. This whole "
@@ -43,14 +43,17 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <recipient>"};
+}  // namespace
+
 CmdPeerStoreSecret::CmdPeerStoreSecret()
 {
-    command = "peerstoresecret";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <recipient>";
-    category = catMisc;
-    help = "Request a nym to store a BIP-39 seed on behalf of the requestor";
+    setArguments(arguments);
 }
 
 CmdPeerStoreSecret::~CmdPeerStoreSecret() {}
@@ -77,28 +80,28 @@ std::int32_t CmdPeerStoreSecret::run(
         return -1;
     }
 
-    const std::string primary = inputText("Word list");
+    const std::string primary = inputValue("Word list");
 
     if (0 == primary.size()) {
 
         return -1;
     }
 
-    const std::string secondary = inputText("Passphrase");
+    const std::string secondary = inputValue("Passphrase");
 
     std::string response;
     {
-        response = OT::App()
-                                     .API()
-                                     .ServerAction()
-                                     .InitiateStoreSecret(
-                                         Identifier(mynym),
-                                         Identifier(server),
-                                         Identifier(hisnym),
-                                         proto::SecretType(1),
-                                         primary,
-                                         secondary)
-                                     ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .InitiateStoreSecret(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    proto::SecretType(1),
+                    primary,
+                    secondary));
     }
 
     return processResponse(response, "peer store secret");
@@ -46,13 +46,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdPingNotary::CmdPingNotary()
 {
-    command = "pingnotary";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMisc;
-    help = "See if a notary is responsive.";
+    setArguments(arguments);
 }
 
 CmdPingNotary::~CmdPingNotary() {}
@@ -42,13 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--items <count>"};
+}  // namespace
+
 CmdPreloadActivity::CmdPreloadActivity()
 {
-    command = "preloadactivity";
-    args[0] = "--mynym <nym>";
-    args[1] = "--items <count>";
-    category = catOtherUsers;
-    help = "Cache messages in all of a nym's threads.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdPreloadActivity::runWithOptions()
@@ -42,15 +42,18 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym ID>",
+    "--thread <thread ID>",
+    "--start <count>",
+    "--items <count>"};
+}  // namespace
+
 CmdPreloadThread::CmdPreloadThread()
 {
-    command = "preloadthread";
-    args[0] = "--mynym <nym ID>";
-    args[1] = "--thread <thread ID>";
-    args[2] = "--start <count>";
-    args[3] = "--items <count>";
-    category = catOtherUsers;
-    help = "Cache message in an activity thread.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdPreloadThread::runWithOptions()
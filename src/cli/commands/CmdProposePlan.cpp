@@ -47,21 +47,24 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--myacct <account>",
+    "--hisacct <account>",
+    "[--memo <consideration>]",
+    "[--daterange <start,length>]",
+    "[--initialpayment <amount,delay>]",
+    "[--paymentplan <amount,delay,period>]",
+    "[--planexpiry <length,number>]"};
+}  // namespace
+
 CmdProposePlan::CmdProposePlan()
 {
-    command = "proposeplan";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--myacct <account>";
-    args[4] = "--hisacct <account>";
-    args[5] = "[--memo <consideration>]";
-    args[6] = "[--daterange <start,length>]";
-    args[7] = "[--initialpayment <amount,delay>";
-    args[8] = "[--paymentplan <amount,delay,period>";
-    args[9] = "[--planexpiry <length,number>";
-    category = catInstruments;
-    help = "as merchant, propose a payment plan to a customer.";
+    setArguments(arguments);
     usage = "Daterange: <start> default is the current time,\n"
             "           <length> default is 'no expiry.'\n"
             "Initialpayment <amount> default is 0 (no initial payment),\n"
@@ -140,7 +143,7 @@ int32_t CmdProposePlan::run(
     otOut << "plan_expiry (length,number): " << planexpiry << "\n";
 
     {
-        if (!OT::App().API().ServerAction().GetTransactionNumbers(
+        if (!getTransactionNumbers(
                 Identifier(mynym), Identifier(server), 2)) {
             otOut << "Error: cannot reserve transaction numbers.\n";
             return -1;
@@ -178,15 +181,15 @@ int32_t CmdProposePlan::run(
     auto payment = std::make_shared<const OTPayment>(String(plan.c_str()));
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .SendPayment(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(hisnym),
-                              payment)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .SendPayment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    payment));
     }
     if (1 != responseStatus(response)) {
         otOut << "Error: cannot send payment plan.\n";
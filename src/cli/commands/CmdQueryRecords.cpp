@@ -0,0 +1,221 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "CmdQueryRecords.hpp"
+
+#include "../ReceiptArchive.hpp"
+#include "../Resolver.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <stdint.h>
+#include <charconv>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+constexpr Arguments arguments{
+    "[--counterparty <id>]",
+    "[--transaction <number>]",
+    "[--minamount <amount>]",
+    "[--maxamount <amount>]",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+
+// a raw amount, which may be negative
+bool parseRawAmount(const char* name, const string& text, int64_t& amount)
+{
+    if ("" == text) { return true; }
+
+    const char* end = text.data() + text.size();
+    auto result = from_chars(text.data(), end, amount);
+    if (errc() != result.ec || end != result.ptr) {
+        otOut << "Error: " << name << ": not a value: " << text << "\n";
+        return false;
+    }
+    return true;
+}
+
+const char* boxName(ReceiptArchive::Box box)
+{
+    switch (box) {
+        case ReceiptArchive::Box::NymRecords:
+            return "nym";
+        case ReceiptArchive::Box::AccountRecords:
+            return "account";
+        case ReceiptArchive::Box::Expired:
+            return "expired";
+    }
+    return "";
+}
+
+string formatDate(int64_t date)
+{
+    const time_t seconds = date;
+    tm parts;
+    char text[32];
+    if (nullptr == gmtime_r(&seconds, &parts) ||
+        0 == strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &parts)) {
+        return to_string(date);
+    }
+    return text;
+}
+}  // namespace
+
+CmdQueryRecords::CmdQueryRecords()
+{
+    setArguments(arguments);
+    ndjsonRows = true;
+    usage = "Counterparty is a nym or account ID. Amounts are raw integers.";
+}
+
+CmdQueryRecords::~CmdQueryRecords() {}
+
+int32_t CmdQueryRecords::runWithOptions()
+{
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
+
+    return run(
+        getOption("counterparty"),
+        getOption("transaction"),
+        getOption("minamount"),
+        getOption("maxamount"),
+        paging);
+}
+
+int32_t CmdQueryRecords::run(
+    string counterparty,
+    string transaction,
+    string minamount,
+    string maxamount,
+    const Paging& paging)
+{
+    ReceiptArchive::Query query;
+
+    if ("" != counterparty) {
+        // the other side is rarely in the wallet, but a name or prefix of
+        // one that is works as well
+        string id;
+        if (Resolver::Result::Found ==
+                Resolver::resolve(Resolver::Kind::Nym, counterparty, id) ||
+            Resolver::Result::Found ==
+                Resolver::resolve(Resolver::Kind::Account, counterparty, id)) {
+            counterparty = id;
+        }
+        query.counterparty = counterparty;
+    }
+
+    if ("" != transaction) {
+        query.number = checkTransNum("transaction", transaction);
+        if (0 > query.number) {
+            return -1;
+        }
+    }
+
+    if (!parseRawAmount("minamount", minamount, query.minAmount) ||
+        !parseRawAmount("maxamount", maxamount, query.maxAmount)) {
+        return -1;
+    }
+
+    if (query.minAmount > query.maxAmount) {
+        otOut << "Error: maxamount: must not be below minamount.\n";
+        return -1;
+    }
+
+    vector<ReceiptArchive::Row> matches;
+    string path = ReceiptArchive::defaultPath();
+    if (!ReceiptArchive(path).query(query, paging, matches)) {
+        otOut << "Error: cannot read the receipt archive " << path << "\n";
+        return -1;
+    }
+
+    if (matches.empty()) {
+        otOut << "No archived records match.\n";
+        return 0;
+    }
+
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Date                 Amt  Type        Txn# InRef#"
+                 "|User / Acct\n";
+        out() << "-------------------------------------------------"
+                 "|(from or to)\n";
+    }
+
+    for (const auto& match : matches) {
+        if (rows) {
+            JsonRow row(out());
+            row.field("box", boxName(match.box))
+                .field("date", match.date)
+                .field("amount", match.amount)
+                .field("type", match.type)
+                .field("transaction", match.number)
+                .field("in_reference_to", match.reference)
+                .field("server", match.server)
+                .field("nym", match.nym)
+                .field("account", match.account)
+                .field("user", match.counterpartyNym)
+                .field("user_account", match.counterpartyAccount);
+            continue;
+        }
+
+        string fmtAmount = formatAmount(match.unit, match.amount);
+        out() << formatDate(match.date) << "  " << fmtAmount
+              << (fmtAmount.size() < 3 ? "    " : "   ") << match.type
+              << (match.type.size() > 10 ? " " : "    ") << match.number
+              << "   " << match.reference << " |U:" << match.counterpartyNym;
+        if ("" != match.counterpartyAccount) {
+            out() << "\n                                                 |A:"
+                  << match.counterpartyAccount;
+        }
+        out() << "\n";
+    }
+
+    return 1;
+}
@@ -0,0 +1,66 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef OPENTXS_CLIENT_CMDQUERYRECORDS_HPP
+#define OPENTXS_CLIENT_CMDQUERYRECORDS_HPP
+
+#include "CmdBase.hpp"
+
+namespace opentxs
+{
+
+class CmdQueryRecords : public CmdBase
+{
+public:
+    EXPORT CmdQueryRecords();
+    virtual ~CmdQueryRecords();
+
+    EXPORT int32_t run(
+        std::string counterparty,
+        std::string transaction,
+        std::string minamount,
+        std::string maxamount,
+        const Paging& paging = Paging());
+
+protected:
+    virtual int32_t runWithOptions();
+};
+
+}  // namespace opentxs
+
+#endif  // OPENTXS_CLIENT_CMDQUERYRECORDS_HPP
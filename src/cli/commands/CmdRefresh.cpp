@@ -48,12 +48,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>"};
+}  // namespace
+
 CmdRefresh::CmdRefresh()
 {
-    command = "refresh";
-    args[0] = "--myacct <account>";
-    category = catWallet;
-    help = "Performs both refreshnym and refreshaccount.";
+    setArguments(arguments);
 }
 
 CmdRefresh::~CmdRefresh() {}
@@ -84,8 +86,11 @@ int32_t CmdRefresh::run(string myacct)
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
-                Identifier(mynym), Identifier(server), Identifier(myacct), true)) {
+        if (!downloadAccount(
+                Identifier(mynym),
+                Identifier(server),
+                Identifier(myacct),
+                true)) {
             otOut << "Error retrieving intermediary files for myacct.\n";
             return -1;
         }
@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>"};
+}  // namespace
+
 CmdRefreshAccount::CmdRefreshAccount()
 {
-    command = "refreshaccount";
-    args[0] = "--myacct <account>";
-    category = catAccounts;
-    help = "Download myacct's latest intermediary files.";
+    setArguments(arguments);
 }
 
 CmdRefreshAccount::~CmdRefreshAccount() {}
@@ -78,8 +80,11 @@ int32_t CmdRefreshAccount::run(string myacct)
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
-                Identifier(mynym), Identifier(server), Identifier(myacct), true)) {
+        if (!downloadAccount(
+                Identifier(mynym),
+                Identifier(server),
+                Identifier(myacct),
+                true)) {
             otOut << "Error retrieving intermediary files for myacct.\n";
             return -1;
         }
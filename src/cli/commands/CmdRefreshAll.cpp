@@ -43,12 +43,7 @@
 namespace opentxs
 {
 
-CmdRefreshAll::CmdRefreshAll()
-{
-    command = "refreshall";
-    category = catWallet;
-    help = "Refresh all nyms in the wallet on all servers.";
-}
+CmdRefreshAll::CmdRefreshAll() {}
 
 int32_t CmdRefreshAll::runWithOptions() { return run(); }
 
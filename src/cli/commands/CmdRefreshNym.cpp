@@ -49,13 +49,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdRefreshNym::CmdRefreshNym()
 {
-    command = "refreshnym";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catNyms;
-    help = "Download mynym's latest intermediary files.";
+    setArguments(arguments);
 }
 
 CmdRefreshNym::~CmdRefreshNym() {}
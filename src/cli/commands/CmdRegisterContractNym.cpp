@@ -46,14 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>"};
+}  // namespace
+
 CmdRegisterContractNym::CmdRegisterContractNym()
 {
-    command = "registercontractnym";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    category = catMisc;
-    help = "Upload a nym's credentials to a server without registering.";
+    setArguments(arguments);
 }
 
 CmdRegisterContractNym::~CmdRegisterContractNym() {}
@@ -79,12 +82,12 @@ int32_t CmdRegisterContractNym::run(string server, string mynym, string hisnym)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .PublishNym(
-                Identifier(mynym), Identifier(server), Identifier(hisnym))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .PublishNym(
+                    Identifier(mynym), Identifier(server), Identifier(hisnym)));
     }
 
     return processResponse(response, "register contract");
@@ -46,14 +46,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hispurse <nym>"};
+}  // namespace
+
 CmdRegisterContractServer::CmdRegisterContractServer()
 {
-    command = "registercontractserver";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hispurse <nym>";
-    category = catMisc;
-    help = "Upload a server contract to a server.";
+    setArguments(arguments);
 }
 
 CmdRegisterContractServer::~CmdRegisterContractServer() {}
@@ -78,12 +81,14 @@ int32_t CmdRegisterContractServer::run(
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .PublishServerContract(
-                Identifier(mynym), Identifier(server), Identifier(hispurse))
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .PublishServerContract(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hispurse)));
     }
 
     return processResponse(response, "register contract");
@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdRegisterNym::CmdRegisterNym()
 {
-    command = "registernym";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catAdmin;
-    help = "Register mynym onto an OT server.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdRegisterNym::runWithOptions()
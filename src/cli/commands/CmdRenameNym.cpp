@@ -47,13 +47,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--label <label>"};
+}  // namespace
+
 CmdRenameNym::CmdRenameNym()
 {
-    command = "renamenym";
-    args[0] = "--mynym <nym>";
-    args[1] = "--label <label>";
-    category = catWallet;
-    help = "Rename one of your own nyms and set appropriate claims.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdRenameNym::runWithOptions()
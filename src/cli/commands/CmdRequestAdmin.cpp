@@ -43,14 +43,17 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <server password>"};
+}  // namespace
+
 CmdRequestAdmin::CmdRequestAdmin()
 {
-    command = "requestadmin";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <server password>";
-    category = catMisc;
-    help = "Request to become the admin nym for a server";
+    setArguments(arguments);
 }
 
 CmdRequestAdmin::~CmdRequestAdmin() {}
@@ -79,11 +82,11 @@ std::int32_t CmdRequestAdmin::run(
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .RequestAdmin(Identifier(mynym), Identifier(server), hisnym)
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .RequestAdmin(Identifier(mynym), Identifier(server), hisnym));
     }
 
     return processResponse(response, "request admin");
@@ -43,15 +43,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse <unit definition id>"};
+}  // namespace
+
 CmdRequestBailment::CmdRequestBailment()
 {
-    command = "requestbailment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse <unit definition id>";
-    category = catOtherUsers;
-    help = "Ask the issuer of a unit to accept a deposit";
+    setArguments(arguments);
 }
 
 CmdRequestBailment::~CmdRequestBailment() {}
@@ -89,15 +92,15 @@ std::int32_t CmdRequestBailment::run(
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .InitiateBailment(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse))
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .InitiateBailment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse)));
     }
     return processResponse(response, "request bailment");
 }
@@ -45,15 +45,18 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse <connection type>"};
+}  // namespace
+
 CmdRequestConnection::CmdRequestConnection()
 {
-    command = "requestconnection";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse <connection type>";
-    category = catOtherUsers;
-    help = "Request service connection info from another user";
+    setArguments(arguments);
 }
 
 CmdRequestConnection::~CmdRequestConnection() {}
@@ -101,15 +104,15 @@ std::int32_t CmdRequestConnection::run(
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .InitiateRequestConnection(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   proto::ConnectionInfoType(type))
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .InitiateRequestConnection(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    proto::ConnectionInfoType(type)));
     }
 
     return processResponse(response, "request connection");
@@ -43,16 +43,19 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--mypurse <purse>",
+    "--amount <amount>"};
+}  // namespace
+
 CmdRequestOutBailment::CmdRequestOutBailment()
 {
-    command = "requestoutbailment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--mypurse <purse>";
-    args[4] = "--amount <amount>";
-    category = catOtherUsers;
-    help = "Ask the issuer of a unit to process a withdrawal";
+    setArguments(arguments);
 }
 
 CmdRequestOutBailment::~CmdRequestOutBailment() {}
@@ -95,24 +98,24 @@ std::int32_t CmdRequestOutBailment::run(
         return -1;
     }
 
-    std::int64_t outbailmentAmount = SwigWrap::StringToAmount(mypurse, amount);
+    std::int64_t outbailmentAmount = parseAmount(mypurse, amount);
     if (OT_ERROR_AMOUNT == outbailmentAmount) {
         return -1;
     }
 
     std::string response;
     {
-        response = OT::App()
-                               .API()
-                               .ServerAction()
-                               .InitiateOutbailment(
-                                   Identifier(mynym),
-                                   Identifier(server),
-                                   Identifier(hisnym),
-                                   Identifier(mypurse),
-                                   outbailmentAmount,
-                                   terms)
-                               ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .InitiateOutbailment(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    Identifier(mypurse),
+                    outbailmentAmount,
+                    terms));
     }
     return processResponse(response, "request outbailment");
 }
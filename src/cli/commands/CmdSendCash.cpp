@@ -47,19 +47,22 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "[--server <server>]",
+    "[--mynym <nym>]",
+    "[--myacct <account>]",
+    "[--mypurse <purse>]",
+    "--hisnym <nym>",
+    "--amount <amount>",
+    "[--indices <indices|all>]",
+    "[--password <true|false>]"};
+}  // namespace
+
 CmdSendCash::CmdSendCash()
 {
-    command = "sendcash";
-    args[0] = "[--server <server>]";
-    args[1] = "[--mynym <nym>]";
-    args[2] = "[--myacct <account>]";
-    args[3] = "[--mypurse <purse>]";
-    args[4] = "--hisnym <nym>";
-    args[5] = "--amount <amount>";
-    args[6] = "[--indices <indices|all>]";
-    args[7] = "[--password <true|false>]";
-    category = catOtherUsers;
-    help = "Send cash from mypurse to recipient, withdraw if necessary.";
+    setArguments(arguments);
     usage = "Specify either myacct OR mypurse.\n"
             "When mypurse is specified server and mynym are mandatory.";
 }
@@ -169,7 +172,7 @@ int32_t CmdSendCash::run(
         return -1;
     }
 
-    cout << response << "\n";
+    out() << response << "\n";
 
     return 1;
 }
@@ -45,16 +45,19 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--hisnym <nym>]",
+    "--amount <amount>",
+    "[--memo <memoline>]",
+    "[--validfor <seconds>]"};
+}  // namespace
+
 CmdSendCheque::CmdSendCheque()
 {
-    command = "sendcheque";
-    args[0] = "--myacct <account>";
-    args[1] = "[--hisnym <nym>]";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    args[4] = "[--validfor <seconds>]";
-    category = catOtherUsers;
-    help = "Write a cheque and then send it to the recipient.";
+    setArguments(arguments);
     usage = "Use writecheque if you don't want to send it immediately.";
 }
 
@@ -82,7 +85,7 @@ int32_t CmdSendCheque::run(
         return -1;
     }
 
-    cout << cheque << "\n";
+    out() << cheque << "\n";
 
     return sendPayment(cheque, "", "send cheque");
 }
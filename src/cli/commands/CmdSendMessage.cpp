@@ -42,14 +42,17 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--server [<server>]"};
+}  // namespace
+
 CmdSendMessage::CmdSendMessage()
 {
-    command = "sendmessage";
-    args[0] = "--mynym <nym>";
-    args[1] = "--hisnym <nym>";
-    args[2] = "--server [<server>]";
-    category = catOtherUsers;
-    help = "Send a message to hisnym's in-mail.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdSendMessage::contact(
@@ -85,13 +88,12 @@ std::int32_t CmdSendMessage::nym(
 
     std::string response;
     {
-        response = OT::App()
-                            .API().ServerAction().SendMessage(
-                                 Identifier(mynym),
-                                 Identifier(server),
-                                 Identifier(hisnym),
-                                 message)
-                               ->Run();
+        response = notaryRun(
+            OT::App().API().ServerAction().SendMessage(
+                Identifier(mynym),
+                Identifier(server),
+                Identifier(hisnym),
+                message));
     }
 
     return processResponse(response, "send message");
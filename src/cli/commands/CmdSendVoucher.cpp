@@ -49,15 +49,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "--hisnym <nym>",
+    "--amount <amount>",
+    "[--memo <memoline>]"};
+}  // namespace
+
 CmdSendVoucher::CmdSendVoucher()
 {
-    command = "sendvoucher";
-    args[0] = "--myacct <account>";
-    args[1] = "--hisnym <nym>";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    category = catOtherUsers;
-    help = "Withdraw a voucher and then send it to the recipient.";
+    setArguments(arguments);
     usage = "Use withdrawvoucher if you don't want to send it immediately.";
 }
 
@@ -97,7 +100,7 @@ int32_t CmdSendVoucher::run(
         return -1;
     }
 
-    cout << voucher << "\n";
+    out() << voucher << "\n";
 
     string sender = SwigWrap::GetAccountWallet_NymID(myacct);
     if ("" == sender) {
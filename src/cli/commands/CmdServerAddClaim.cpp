@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdServerAddClaim::CmdServerAddClaim()
 {
-    command = "serveraddclaim";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMisc;
-    help = "Request the server to add a claim to its nym credentials";
+    setArguments(arguments);
 }
 
 CmdServerAddClaim::~CmdServerAddClaim() {}
@@ -69,28 +70,28 @@ std::int32_t CmdServerAddClaim::run(std::string server, std::string mynym)
         return -1;
     }
 
-    const std::string section = inputText("Section");
+    const std::string section = inputValue("Section");
 
     if (0 == section.size()) {
 
         return -1;
     }
 
-    const std::string type = inputText("Type");
+    const std::string type = inputValue("Type");
 
     if (0 == type.size()) {
 
         return -1;
     }
 
-    const std::string value = inputText("Value");
+    const std::string value = inputValue("Value");
 
     if (0 == section.size()) {
 
         return -1;
     }
 
-    const std::string strPrimary = inputText("Primary? (true or false)");
+    const std::string strPrimary = inputValue("Primary? (true or false)");
     bool primary = true;
 
     if ("false" == strPrimary) {
@@ -100,17 +101,17 @@ std::int32_t CmdServerAddClaim::run(std::string server, std::string mynym)
 
     std::string response;
     {
-        response = OT::App()
-            .API()
-            .ServerAction()
-            .AddServerClaim(
-                Identifier(mynym),
-                Identifier(server),
-                proto::ContactSectionName(std::stoi(section)),
-                proto::ContactItemType(std::stoi(type)),
-                value,
-                primary)
-            ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AddServerClaim(
+                    Identifier(mynym),
+                    Identifier(server),
+                    proto::ContactSectionName(std::stoi(section)),
+                    proto::ContactItemType(std::stoi(type)),
+                    value,
+                    primary));
     }
 
     return processResponse(response, "server add claim");
@@ -42,15 +42,18 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <id>",
+    "--section <section>",
+    "--type <type>",
+    "--value <data>"};
+}  // namespace
+
 CmdSetProfileValue::CmdSetProfileValue()
 {
-    command = "setprofilevalue";
-    args[0] = "--mynym <id>";
-    args[1] = "--section <section>";
-    args[2] = "--type <type>";
-    args[3] = "--value <data>";
-    category = catNyms;
-    help = "Add data to a profile";
+    setArguments(arguments);
 }
 
 std::int32_t CmdSetProfileValue::runWithOptions()
@@ -46,13 +46,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym id>", "--myacct <account id>"};
+}  // namespace
+
 CmdShowAccount::CmdShowAccount()
 {
-    command = "showaccount";
-    args[0] = "--mynym <nym id>";
-    args[1] = "--myacct <account id>";
-    category = catAccounts;
-    help = "Show myacct's stats.";
+    setArguments(arguments);
 }
 
 void CmdShowAccount::display_row(const ui::BalanceItem& row) const
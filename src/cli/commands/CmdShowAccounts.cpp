@@ -49,9 +49,7 @@ using namespace std;
 
 CmdShowAccounts::CmdShowAccounts()
 {
-    command = "showaccounts";
-    category = catWallet;
-    help = "Show the asset accounts in the wallet.";
+    ndjsonRows = true;
 }
 
 CmdShowAccounts::~CmdShowAccounts() {}
@@ -61,8 +59,11 @@ int32_t CmdShowAccounts::runWithOptions() { return run(); }
 int32_t CmdShowAccounts::run()
 {
     const auto& storage = OT::App().DB();
-    cout << " ** ACCOUNTS:\n";
-    dashLine();
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << " ** ACCOUNTS:\n";
+        dashLine();
+    }
 
     for (const auto& it : storage.AccountList()) {
         const auto& myacct = std::get<0>(it);
@@ -72,16 +73,49 @@ int32_t CmdShowAccounts::run()
             return -1;
         }
 
+        if (rows) {
+            if (!accountRow(myacct)) {
+                otOut << "Error : cannot load account data.\n";
+                return -1;
+            }
+            continue;
+        }
+
         string accountData = stat_asset_account(myacct);
 
         if ("" == accountData) {
-            cout << "Error : cannot load account data.\n";
+            out() << "Error : cannot load account data.\n";
             return -1;
         }
 
-        cout << accountData << "\n";
+        out() << accountData << "\n";
         dashLine();
     }
 
     return 1;
 }
+
+// the fields of stat_asset_account(), without building the text block
+bool CmdShowAccounts::accountRow(const string& myacct) const
+{
+    string mynym = SwigWrap::GetAccountWallet_NymID(myacct);
+    string assetType =
+        SwigWrap::GetAccountWallet_InstrumentDefinitionID(myacct);
+    if (!VerifyStringVal(mynym) || !VerifyStringVal(assetType)) {
+        return false;
+    }
+
+    string server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+
+    JsonRow row(out());
+    row.field("account", myacct)
+        .field("name", SwigWrap::GetAccountWallet_Name(myacct))
+        .field("balance", SwigWrap::GetAccountWallet_Balance(myacct))
+        .field("asset_type", assetType)
+        .field("asset_type_name", SwigWrap::GetAssetType_Name(assetType))
+        .field("nym", mynym)
+        .field("nym_name", SwigWrap::GetNym_Name(mynym))
+        .field("server", server)
+        .field("server_name", SwigWrap::GetServer_Name(server));
+    return true;
+}
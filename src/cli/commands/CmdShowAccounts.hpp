@@ -148,6 +148,9 @@ public:
 
 protected:
     virtual int32_t runWithOptions();
+
+private:
+    bool accountRow(const std::string& myacct) const;
 };
 
 } // namespace opentxs
@@ -49,14 +49,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "[--mynym <nym>]",
+    "[--id <transactionnr>]"};
+}  // namespace
+
 CmdShowActive::CmdShowActive()
 {
-    command = "showactive";
-    args[0] = "--server <server>";
-    args[1] = "[--mynym <nym>]";
-    args[2] = "[--id <transactionnr>]";
-    category = catInstruments;
-    help = "Show the active cron item IDs, or the details of one by ID.";
+    setArguments(arguments);
     usage = "Specify either of --mynym and --id.";
 }
 
@@ -121,7 +124,7 @@ int32_t CmdShowActive::run(string server, string mynym, string id)
                 if ("" == type) {
                     type = "UNKNOWN";
                 }
-                cout << "ID: " << transNum << "  Type: " << type << "\n\n";
+                out() << "ID: " << transNum << "  Type: " << type << "\n\n";
             }
         }
     }
@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdShowAssets::CmdShowAssets()
-{
-    command = "showassets";
-    category = catWallet;
-    help = "Show the currency contracts in the wallet.";
-}
+CmdShowAssets::CmdShowAssets() {}
 
 CmdShowAssets::~CmdShowAssets() {}
 
@@ -71,13 +66,13 @@ int32_t CmdShowAssets::run()
         return 0;
     }
 
-    cout << " ** ASSET TYPES:\n";
+    out() << " ** ASSET TYPES:\n";
     dashLine();
 
     for (int32_t i = 0; i < items; i++) {
         string assetType = SwigWrap::GetAssetType_ID(i);
         string name = SwigWrap::GetAssetType_Name(assetType);
-        cout << i << ": " << assetType << "  -  " << name << "\n";
+        out() << i << ": " << assetType << "  -  " << name << "\n";
     }
 
     return 1;
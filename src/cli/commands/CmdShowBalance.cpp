@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>"};
+}  // namespace
+
 CmdShowBalance::CmdShowBalance()
 {
-    command = "showbalance";
-    args[0] = "--myacct <account>";
-    category = catAccounts;
-    help = "Show myacct's balance.";
+    setArguments(arguments);
 }
 
 CmdShowBalance::~CmdShowBalance() {}
@@ -82,8 +84,8 @@ int32_t CmdShowBalance::run(string myacct)
         return -1;
     }
 
-    cout << "Balance: " << formatAmount(assetType, balance) << "\n";
-    cout << myacct << " (" << name << ")\n\n";
+    out() << "Balance: " << formatAmount(assetType, balance) << "\n";
+    out() << myacct << " (" << name << ")\n\n";
 
     return 1;
 }
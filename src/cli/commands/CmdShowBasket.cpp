@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"[--index <index>]"};
+}  // namespace
+
 CmdShowBasket::CmdShowBasket()
 {
-    command = "showbasket";
-    args[0] = "[--index <index>]";
-    category = catBaskets;
-    help = "Show basket currency details.";
+    setArguments(arguments);
     usage = "Omitting --indices lists all basket currencies.";
 }
 
@@ -75,18 +77,18 @@ int32_t CmdShowBasket::run(string index)
 
     // all items?
     if ("" == index) {
-        cout << "Index |  Basket currencies:\n";
+        out() << "Index |  Basket currencies:\n";
         dashLine();
 
         for (int32_t i = 0; i < items; i++) {
             string assetType = SwigWrap::GetAssetType_ID(i);
             if ("" != assetType && SwigWrap::IsBasketCurrency(assetType)) {
-                cout << i << ": " << assetType;
+                out() << i << ": " << assetType;
                 string assetName = SwigWrap::GetAssetType_Name(assetType);
                 if ("" != assetName) {
-                    cout << " : " + assetName;
+                    out() << " : " + assetName;
                 }
-                cout << "\n";
+                out() << "\n";
             }
         }
 
@@ -124,12 +126,12 @@ int32_t CmdShowBasket::run(string index)
         return -1;
     }
 
-    cout << "Name: " << assetName << "\n";
-    cout << "ID:   " << assetType << "\n";
+    out() << "Name: " << assetName << "\n";
+    out() << "ID:   " << assetType << "\n";
 
-    cout << "Minimum transfer amount for basket:     " << minAmount << "\n";
-    cout << "Number of sub-currencies in the basket: " << currencies << "\n";
-    cout << "    Index  :  Min Transfer Amount  :  Member currency  \n";
+    out() << "Minimum transfer amount for basket:     " << minAmount << "\n";
+    out() << "Number of sub-currencies in the basket: " << currencies << "\n";
+    out() << "    Index  :  Min Transfer Amount  :  Member currency  \n";
     dashLine();
 
     for (int32_t i = 0; i < currencies; i++) {
@@ -138,8 +140,8 @@ int32_t CmdShowBasket::run(string index)
         int64_t min =
             SwigWrap::Basket_GetMemberMinimumTransferAmount(assetType, i);
 
-        cout << "    " << i << "      : " << min << " : " << type << " : "
-             << name << "\n";
+        out() << "    " << i << "      : " << min << " : " << type << " : "
+              << name << "\n";
     }
 
     return 1;
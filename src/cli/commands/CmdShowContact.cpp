@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--contact <id>"};
+}  // namespace
+
 CmdShowContact::CmdShowContact()
 {
-    command = "showcontact";
-    args[0] = "--contact <id>";
-    category = catOtherUsers;
-    help = "Display contact data";
+    setArguments(arguments);
 }
 
 void CmdShowContact::display_groups(const ui::ContactSection& section) const
@@ -43,12 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdShowContacts::CmdShowContacts()
 {
-    command = "showcontacts";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Show the contact list for a nym in the wallet.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdShowContacts::runWithOptions()
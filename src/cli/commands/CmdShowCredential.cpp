@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--id <credentialid>"};
+}  // namespace
+
 CmdShowCredential::CmdShowCredential()
 {
-    command = "showcredential";
-    args[0] = "--mynym <nym>";
-    args[1] = "--id <credentialid>";
-    category = catNyms;
-    help = "Show a specific credential in detail.";
+    setArguments(arguments);
 }
 
 CmdShowCredential::~CmdShowCredential() {}
@@ -71,13 +72,13 @@ int32_t CmdShowCredential::run(string mynym, string id)
 
     string credential = SwigWrap::GetNym_MasterCredentialContents(mynym, id);
     if ("" != credential) {
-        cout << "Master Credential contents:\n" << credential << "\n";
+        out() << "Master Credential contents:\n" << credential << "\n";
         return 1;
     }
 
     credential = SwigWrap::GetNym_RevokedCredContents(mynym, id);
     if ("" != credential) {
-        cout << "Revoked Credential contents:\n" << credential << "\n";
+        out() << "Revoked Credential contents:\n" << credential << "\n";
         return 1;
     }
 
@@ -92,7 +93,7 @@ int32_t CmdShowCredential::run(string mynym, string id)
             return -1;
         }
 
-        cout << "Credential contents:\n" << credential << "\n";
+        out() << "Credential contents:\n" << credential << "\n";
         return 1;
     }
 
@@ -108,7 +109,7 @@ int32_t CmdShowCredential::run(string mynym, string id)
         return -1;
     }
 
-    cout << "Revoked Credential contents:\n" << credential << "\n";
+    out() << "Revoked Credential contents:\n" << credential << "\n";
     return 1;
 }
 
@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdShowCredentials::CmdShowCredentials()
 {
-    command = "showcredentials";
-    args[0] = "--mynym <nym>";
-    category = catNyms;
-    help = "Show mynym's credentials.";
+    setArguments(arguments);
 }
 
 CmdShowCredentials::~CmdShowCredentials() {}
@@ -70,25 +72,25 @@ int32_t CmdShowCredentials::run(string mynym)
         otOut << "The credential list is empty.\n";
     }
     else {
-        otOut << "Idx     Credential ID\n"
+        out() << "Idx     Credential ID\n"
                  "---------------------------\n";
 
         auto i = 0;
         for (auto masterCredentialID : masterCredentialIDs) {
             auto masterCredential = masterCredentialID->str();
-            cout << i++ << ":      " << masterCredential << "\n";
+            out() << i++ << ":      " << masterCredential << "\n";
 
             auto childCredentialIDs =
                 nym->GetChildCredentialIDs(masterCredentialID->str());
             if (childCredentialIDs.size()) {
-                otOut << "        ---------------------------\n"
+                out() << "        ---------------------------\n"
                          "        Idx     Credential ID\n"
                          "        ---------------------------\n";
 
                 auto j = 0;
                 for (auto childCredentialID : childCredentialIDs) {
-                    cout << "        " << j++ << ":      "
-                         << childCredentialID->str() << "\n";
+                    out() << "        " << j++ << ":      "
+                          << childCredentialID->str() << "\n";
                 }
             }
         }
@@ -97,28 +99,28 @@ int32_t CmdShowCredentials::run(string mynym)
     auto revokedCredentialIDs = nym->GetRevokedCredentialIDs();
 
     if (0 == revokedCredentialIDs.size()) {
-        cout << "The revoked credential list is empty.\n";
+        out() << "The revoked credential list is empty.\n";
     }
     else {
-        otOut << "Idx     Revoked Credential ID\n"
+        out() << "Idx     Revoked Credential ID\n"
                  "---------------------------\n";
 
         auto i = 0;
         for (auto revokedCredentialID : revokedCredentialIDs) {
             auto revokedCredential = revokedCredentialID->str();
-            cout << i++ << ":      " << revokedCredential << "\n";
+            out() << i++ << ":      " << revokedCredential << "\n";
 
             auto childCredentialIDs =
                 nym->GetChildCredentialIDs(revokedCredentialID->str());
             if (childCredentialIDs.size()) {
-                otOut << "        ---------------------------\n"
+                out() << "        ---------------------------\n"
                          "        Idx     Revoked Credential ID\n"
                          "        ---------------------------\n";
 
                 auto j = 0;
                 for (auto childCredentialID : childCredentialIDs) {
-                    cout << "        " << j++ << ":      "
-                         << childCredentialID->str() << "\n";
+                    out() << "        " << j++ << ":      "
+                          << childCredentialID->str() << "\n";
                 }
             }
         }
@@ -38,6 +38,8 @@
 
 #include "CmdShowExpired.hpp"
 
+#include "../LedgerSnapshot.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
@@ -47,20 +49,34 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+}  // namespace
+
 CmdShowExpired::CmdShowExpired()
 {
-    command = "showexpired";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMisc;
-    help = "Show mynym's expired record box.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 CmdShowExpired::~CmdShowExpired() {}
 
 int32_t CmdShowExpired::runWithOptions()
 {
-    return run(getOption("server"), getOption("mynym"));
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
+
+    return run(getOption("server"), getOption("mynym"), paging);
 }
 
 // TODO: This is based on details_show_record which assumes it can contain asset
@@ -71,7 +87,10 @@ int32_t CmdShowExpired::runWithOptions()
 // this case. In fact we will also want to update details_show_record to do the
 // same thing, in cases where the nymID and the account ID are the same.
 
-int32_t CmdShowExpired::run(string server, string mynym)
+int32_t CmdShowExpired::run(
+    string server,
+    string mynym,
+    const Paging& paging)
 {
     if (!checkServer("server", server)) {
         return -1;
@@ -81,67 +100,41 @@ int32_t CmdShowExpired::run(string server, string mynym)
         return -1;
     }
 
-    string expired = SwigWrap::LoadExpiredBox(server, mynym);
-    if ("" == expired) {
+    LedgerSnapshot expired;
+    if (!expired.load(
+            LedgerSnapshot::Box::ExpiredBox, server, mynym, mynym, paging)) {
         otOut << "Error: cannot load expired record box.\n";
         return -1;
     }
 
-    int32_t items = SwigWrap::Ledger_GetCount(server, mynym, mynym, expired);
-    if (0 > items) {
-        otOut << "Error: cannot load expired record box item count.\n";
-        return -1;
+    if (0 == expired.size()) {
+        otOut << (0 == expired.total ? "The expired record box is empty.\n"
+                                     : "No expired records in that range.\n");
+        return 0;
     }
 
-    if (0 == items) {
-        otOut << "The expired record box is empty.\n";
-        return 0;
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Expired records:\n";
+        out() << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
+        out() << "---------------------------------|(from or to)\n";
     }
 
-    cout << "Expired records:\n";
-    cout << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
-    cout << "---------------------------------|(from or to)\n";
-
-    for (int32_t i = 0; i < items; i++) {
-        string tx = SwigWrap::Ledger_GetTransactionByIndex(
-            server, mynym, mynym, expired, i);
-        int64_t txNum = SwigWrap::Ledger_GetTransactionIDByIndex(
-            server, mynym, mynym, expired, i);
-        int64_t refNum = SwigWrap::Transaction_GetDisplayReferenceToNum(
-            server, mynym, mynym, tx);
-        int64_t amount =
-            SwigWrap::Transaction_GetAmount(server, mynym, mynym, tx);
-        string type = SwigWrap::Transaction_GetType(server, mynym, mynym, tx);
-        string senderUser =
-            SwigWrap::Transaction_GetSenderNymID(server, mynym, mynym, tx);
-        string senderAcct =
-            SwigWrap::Transaction_GetSenderAcctID(server, mynym, mynym, tx);
-        string recipientUser =
-            SwigWrap::Transaction_GetRecipientNymID(server, mynym, mynym, tx);
-        string recipientAcct =
-            SwigWrap::Transaction_GetRecipientAcctID(server, mynym, mynym, tx);
-
-        string user = "" != senderUser ? senderUser : recipientUser;
-        string acct = "" != senderAcct ? senderAcct : recipientAcct;
-
-        string separator = "";
-        if ("" != user || "" != acct) {
-            separator = "\n                                 |";
+    for (size_t i = 0; i < expired.size(); i++) {
+        if (rows) {
+            JsonRow row(out());
+            row.field("index", static_cast<int64_t>(expired.position[i]))
+                .field("date", expired.date[i])
+                .field("amount", expired.amount[i])
+                .field("type", expired.type[i])
+                .field("transaction", expired.number[i])
+                .field("in_reference_to", expired.reference[i])
+                .field("user", expired.user(i))
+                .field("account", expired.account(i));
+            continue;
         }
 
-        string userDenoter = "" != user ? "U:" : "";
-        string acctDenoter = "" != acct ? "A:" : "";
-
-        string assetType = "" != acct ? getAccountAssetType(acct) : "";
-
-        string fmtAmount = formatAmount(assetType, amount);
-
-        cout << i << "    ";
-        cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
-        cout << type << (type.size() > 10 ? " " : "    ");
-        cout << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
-        cout << refNum << (to_string(refNum).size() > 2 ? "  " : " ") << "|";
-        cout << userDenoter << user << separator << acctDenoter << acct << "\n";
+        receiptLine(expired, i, expired.user(i), expired.account(i));
     }
 
     return 1;
@@ -144,7 +144,10 @@ public:
     EXPORT CmdShowExpired();
     virtual ~CmdShowExpired();
 
-    EXPORT int32_t run(std::string server, std::string mynym);
+    EXPORT int32_t run(
+        std::string server,
+        std::string mynym,
+        const Paging& paging = Paging());
 
 protected:
     virtual int32_t runWithOptions();
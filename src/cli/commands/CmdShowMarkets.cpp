@@ -47,12 +47,15 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>"};
+}  // namespace
+
 CmdShowMarkets::CmdShowMarkets()
 {
-    command = "showmarkets";
-    args[0] = "--server <server>";
-    category = catMarkets;
-    help = "Show the list of markets.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 CmdShowMarkets::~CmdShowMarkets() {}
@@ -82,7 +85,10 @@ int32_t CmdShowMarkets::run(string server)
         return 0;
     }
 
-    cout << "Index\tScale\tMarket\t\t\t\t\t\tAsset\t\t\t\t\t\tCurrency\n";
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Index\tScale\tMarket\t\t\t\t\t\tAsset\t\t\t\t\t\tCurrency\n";
+    }
 
     for (int32_t i = 0; i < items; i++) {
         OTDB::MarketData* marketData = marketList->GetMarketData(i);
@@ -91,10 +97,20 @@ int32_t CmdShowMarkets::run(string server)
             return -1;
         }
 
-        cout << i << "\t" << marketData->scale << "\tM "
-             << marketData->market_id << "\tA "
-             << marketData->instrument_definition_id << "\tC "
-             << marketData->currency_type_id << "\n";
+        if (rows) {
+            JsonRow row(out());
+            row.field("index", i)
+                .field("scale", marketData->scale)
+                .field("market", marketData->market_id)
+                .field("asset_type", marketData->instrument_definition_id)
+                .field("currency", marketData->currency_type_id);
+            continue;
+        }
+
+        out() << i << "\t" << marketData->scale << "\tM "
+              << marketData->market_id << "\tA "
+              << marketData->instrument_definition_id << "\tC "
+              << marketData->currency_type_id << "\n";
     }
 
     return 1;
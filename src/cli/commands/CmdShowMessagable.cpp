@@ -43,12 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdShowMessagable::CmdShowMessagable()
 {
-    command = "showmessagable";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help = "Show the list of messabable contacts for a nym in the wallet.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdShowMessagable::runWithOptions()
@@ -47,15 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--mypurse <purse>"};
+}  // namespace
+
 CmdShowMint::CmdShowMint()
 {
-    command = "showmint";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--mypurse <purse>";
-    category = catAdmin;
-    help = "Show mint file for specific instrument definition id. Download if "
-           "necessary.";
+    setArguments(arguments);
 }
 
 CmdShowMint::~CmdShowMint() {}
@@ -97,14 +99,14 @@ std::string CmdShowMint::load_or_retrieve_mint(
 
         std::string response;
         {
-            response = OT::App()
-                       .API()
-                       .ServerAction()
-                       .DownloadMint(
-                           Identifier(nymID),
-                           Identifier(notaryID),
-                           Identifier(unitTypeID))
-                       ->Run();
+            response = notaryRun(
+                OT::App()
+                    .API()
+                    .ServerAction()
+                    .DownloadMint(
+                        Identifier(nymID),
+                        Identifier(notaryID),
+                        Identifier(unitTypeID)));
         }
 
         if (1 != VerifyMessageSuccess(response)) {
@@ -168,7 +170,7 @@ int32_t CmdShowMint::run(string server, string mynym, string mypurse)
         return -1;
     }
 
-    cout << mint << "\n";
+    out() << mint << "\n";
 
     return 1;
 #else
@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--mynym <nym>"};
+}  // namespace
+
 CmdShowMyOffers::CmdShowMyOffers()
 {
-    command = "showmyoffers";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    category = catMarkets;
-    help = "Show mynym's offers on a particular server.";
+    setArguments(arguments);
 }
 
 CmdShowMyOffers::~CmdShowMyOffers() {}
@@ -44,12 +44,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdShowNym::CmdShowNym()
 {
-    command = "shownym";
-    args[0] = "--mynym <nym>";
-    category = catNyms;
-    help = "Show mynym's statistics.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdShowNym::runWithOptions() { return run(getOption("mynym")); }
@@ -67,13 +69,13 @@ std::int32_t CmdShowNym::run(std::string mynym)
     }
 
     std::string claims = SwigWrap::DumpContactData(mynym);
-    std::cout << nymStats << std::endl << claims;
+    out() << nymStats << std::endl << claims;
     auto nym = OT::App().Wallet().Nym(Identifier(mynym));
 
     if (nym) {
         const auto armored =
             proto::ProtoAsArmored(nym->asPublicNym(), "PUBLIC NYM");
-        std::cout << armored << std::endl;
+        out() << armored << "\n";
     }
 
     return 1;
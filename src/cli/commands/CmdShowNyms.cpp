@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdShowNyms::CmdShowNyms()
-{
-    command = "shownyms";
-    category = catWallet;
-    help = "Show the nyms in the wallet.";
-}
+CmdShowNyms::CmdShowNyms() {}
 
 CmdShowNyms::~CmdShowNyms() {}
 
@@ -71,13 +66,13 @@ int32_t CmdShowNyms::run()
         return 0;
     }
 
-    cout << " ** NYMS:\n";
+    out() << " ** NYMS:\n";
     dashLine();
 
     for (int32_t i = 0; i < items; i++) {
         string mynym = SwigWrap::GetNym_ID(i);
         string name = SwigWrap::GetNym_Name(mynym);
-        cout << i << ": " << mynym << " -  " << name << "\n";
+        out() << i << ": " << mynym << " -  " << name << "\n";
     }
 
     return 1;
@@ -38,32 +38,89 @@
 
 #include "CmdShowOffers.hpp"
 
+#include "../OrderBook.hpp"
+
 #include <opentxs/opentxs.hpp>
 
+#include <stddef.h>
 #include <stdint.h>
+#include <charconv>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--market <marketid>",
+    "[--depth <levels>]",
+    "[--aggregate]"};
+
+bool toSize(const string& text, size_t& value)
+{
+    const char* end = text.data() + text.size();
+    auto result = from_chars(text.data(), end, value);
+    return errc() == result.ec && end == result.ptr;
+}
+
+const OrderBook::Side sides[] = {OrderBook::Side::Bid, OrderBook::Side::Ask};
+
+const char* sideName(OrderBook::Side side)
+{
+    return OrderBook::Side::Bid == side ? "bid" : "ask";
+}
+
+const char* sideTitle(OrderBook::Side side)
+{
+    return OrderBook::Side::Bid == side ? "BIDS" : "ASKS";
+}
+
+// the offers in the best "depth" price levels, or all of them for 0
+size_t offersInDepth(
+    const OrderBook& book,
+    OrderBook::Side side,
+    size_t depth)
+{
+    if (0 == depth) { return book.offers(side).size(); }
+
+    size_t offers = 0;
+    for (const auto& level : book.levels(side, depth)) {
+        offers += level.offers;
+    }
+    return offers;
+}
+}  // namespace
+
 CmdShowOffers::CmdShowOffers()
 {
-    command = "showoffers";
-    args[0] = "--server <server>";
-    args[1] = "--market <marketid>";
-    category = catMarkets;
-    help = "Show all offers on a particular server and market.";
+    setArguments(arguments);
+    ndjsonRows = true;
+    usage = "Bids and asks are sorted best first. Use --depth to show only "
+            "the best\nprice levels, and --aggregate to show one line per "
+            "price level with\nits total and cumulative quantity.";
 }
 
 CmdShowOffers::~CmdShowOffers() {}
 
 int32_t CmdShowOffers::runWithOptions()
 {
-    return run(getOption("server"), getOption("market"));
+    return run(
+        getOption("server"),
+        getOption("market"),
+        getOption("depth"),
+        getOption("aggregate"));
 }
 
-int32_t CmdShowOffers::run(string server, string market)
+int32_t CmdShowOffers::run(
+    string server,
+    string market,
+    string depth,
+    string aggregate)
 {
     if (!checkServer("server", server)) {
         return -1;
@@ -73,57 +130,72 @@ int32_t CmdShowOffers::run(string server, string market)
         return -1;
     }
 
-    OTDB::OfferListMarket* offerList = loadMarketOffers(server, market);
-    if (nullptr == offerList) {
+    size_t levels = 0;
+    if ("" != depth) {
+        if (!checkValue("depth", depth)) {
+            return -1;
+        }
+        if (!toSize(depth, levels)) {
+            otOut << "Error: depth is out of range.\n";
+            return -1;
+        }
+    }
+
+    if ("" != aggregate && !checkFlag("aggregate", aggregate)) {
+        return -1;
+    }
+
+    auto offerList = loadMarketOffers(server, market);
+    if (!offerList) {
         otOut << "Error: cannot load market offer list.\n";
         return -1;
     }
 
-    int32_t bidItems = offerList->GetBidDataCount();
-    int32_t askItems = offerList->GetAskDataCount();
-    if (0 == bidItems + askItems) {
-        cout << "The market offer list is empty.\n";
-        return 0;
+    OrderBook book;
+    if (!book.load(*offerList)) {
+        return -1;
     }
+    offerList.reset();
 
-    // loop through the bids and print them out.
-    if (0 != bidItems) {
-        cout << "\n** BIDS **\n\nIndex\tTrans#\tPrice\tAvailable\n";
+    if (book.empty()) {
+        if (!ndjson()) { out() << "The market offer list is empty.\n"; }
+        return 0;
+    }
 
-        for (int32_t i = 0; i < bidItems; i++) {
-            OTDB::BidData* bid = offerList->GetBidData(i);
-            if (nullptr == bid) {
-                otOut << "Error: cannot load bid data at index: " << i << "\n";
-                return -1;
-            }
+    bool byLevel = "true" == aggregate;
 
-            cout << i << "\t" << bid->transaction_id << "\t"
-                 << bid->price_per_scale << "\t" << bid->available_assets
-                 << "\n";
+    if (ndjson()) {
+        if (byLevel) {
+            levelRows(book, levels);
+        } else {
+            offerRows(book, levels);
         }
+        return 1;
     }
 
-    // loop through the asks and print them out.
-    if (0 != askItems) {
-        cout << "\n** ASKS **\n\nIndex\tTrans#\tPrice\tAvailable\n";
-
-        for (int32_t i = 0; i < askItems; i++) {
-            OTDB::AskData* ask = offerList->GetAskData(i);
-            if (nullptr == ask) {
-                otOut << "Error: cannot load ask data at index: " << i << "\n";
-                return -1;
-            }
+    if (byLevel) {
+        levelTable(book, levels);
+    } else {
+        offerTable(book, levels);
+    }
 
-            cout << i << "\t" << ask->transaction_id << "\t"
-                 << ask->price_per_scale << "\t" << ask->available_assets
-                 << "\n";
-        }
+    auto& bids = book.offers(OrderBook::Side::Bid);
+    auto& asks = book.offers(OrderBook::Side::Ask);
+    out() << "\n";
+    if (!bids.empty()) {
+        out() << "Best bid: " << book.best(OrderBook::Side::Bid) << "\n";
+    }
+    if (!asks.empty()) {
+        out() << "Best ask: " << book.best(OrderBook::Side::Ask) << "\n";
+    }
+    if (!bids.empty() && !asks.empty()) {
+        out() << "Spread:   " << book.spread() << "\n";
     }
 
     return 1;
 }
 
-OTDB::OfferListMarket* CmdShowOffers::loadMarketOffers(
+unique_ptr<OTDB::OfferListMarket> CmdShowOffers::loadMarketOffers(
     const string& server,
     const string& market)
 {
@@ -133,13 +205,13 @@ OTDB::OfferListMarket* CmdShowOffers::loadMarketOffers(
 
     otWarn << "Offers file exists... Querying file for market offers...\n";
 
-    OTDB::Storable* storable = OTDB::QueryObject(
+    unique_ptr<OTDB::Storable> storable(OTDB::QueryObject(
         OTDB::STORED_OBJ_OFFER_LIST_MARKET,
         "markets",
         server,
         "offers",
-        market + ".bin");
-    if (nullptr == storable) {
+        market + ".bin"));
+    if (!storable) {
         otOut << "Unable to verify storable object. Probably doesn't "
                  "exist.\n";
         return nullptr;
@@ -149,12 +221,77 @@ OTDB::OfferListMarket* CmdShowOffers::loadMarketOffers(
               "(market) offerList...\n";
 
     OTDB::OfferListMarket* offerList =
-        dynamic_cast<OTDB::OfferListMarket*>(storable);
+        dynamic_cast<OTDB::OfferListMarket*>(storable.get());
     if (nullptr == offerList) {
         otOut << "Unable to dynamic cast a storable to a (market) "
                  "offerList.\n";
         return nullptr;
     }
 
-    return offerList;
+    storable.release();
+    return unique_ptr<OTDB::OfferListMarket>(offerList);
+}
+
+void CmdShowOffers::offerTable(const OrderBook& book, size_t depth) const
+{
+    for (auto side : sides) {
+        auto& offers = book.offers(side);
+        size_t count = offersInDepth(book, side, depth);
+        if (0 == count) { continue; }
+
+        out() << "\n** " << sideTitle(side)
+              << " **\n\nIndex\tTrans#\tPrice\tAvailable\n";
+        for (size_t i = 0; i < count; i++) {
+            out() << i << "\t" << offers[i].transaction << "\t"
+                  << offers[i].price << "\t" << offers[i].quantity << "\n";
+        }
+    }
+}
+
+void CmdShowOffers::levelTable(const OrderBook& book, size_t depth) const
+{
+    for (auto side : sides) {
+        auto levels = book.levels(side, depth);
+        if (levels.empty()) { continue; }
+
+        out() << "\n** " << sideTitle(side)
+              << " **\n\nLevel\tPrice\tQuantity\tOffers\tCumulative\n";
+        for (size_t i = 0; i < levels.size(); i++) {
+            out() << i << "\t" << levels[i].price << "\t"
+                  << levels[i].quantity << "\t" << levels[i].offers << "\t"
+                  << levels[i].cumulative << "\n";
+        }
+    }
+}
+
+void CmdShowOffers::offerRows(const OrderBook& book, size_t depth) const
+{
+    for (auto side : sides) {
+        auto& offers = book.offers(side);
+        size_t count = offersInDepth(book, side, depth);
+        for (size_t i = 0; i < count; i++) {
+            JsonRow row(out());
+            row.field("side", sideName(side))
+                .field("index", static_cast<int64_t>(i))
+                .field("transaction", offers[i].transaction)
+                .field("price", offers[i].price)
+                .field("available", offers[i].quantity);
+        }
+    }
+}
+
+void CmdShowOffers::levelRows(const OrderBook& book, size_t depth) const
+{
+    for (auto side : sides) {
+        auto levels = book.levels(side, depth);
+        for (size_t i = 0; i < levels.size(); i++) {
+            JsonRow row(out());
+            row.field("side", sideName(side))
+                .field("level", static_cast<int64_t>(i))
+                .field("price", levels[i].price)
+                .field("quantity", levels[i].quantity)
+                .field("offers", levels[i].offers)
+                .field("cumulative", levels[i].cumulative);
+        }
+    }
 }
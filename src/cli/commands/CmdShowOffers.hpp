@@ -135,6 +135,8 @@
 
 #include "CmdBase.hpp"
 
+#include <memory>
+
 namespace opentxs
 {
 
@@ -143,13 +145,19 @@ namespace OTDB
 class OfferListMarket;
 }
 
+class OrderBook;
+
 class CmdShowOffers : public CmdBase
 {
 public:
     EXPORT CmdShowOffers();
     virtual ~CmdShowOffers();
 
-    EXPORT int32_t run(std::string server, std::string market);
+    EXPORT int32_t run(
+        std::string server,
+        std::string market,
+        std::string depth = "",
+        std::string aggregate = "");
 
     EXPORT int32_t show(const std::string& server, const std::string& market);
 
@@ -157,8 +165,13 @@ protected:
     virtual int32_t runWithOptions();
 
 private:
-    OTDB::OfferListMarket* loadMarketOffers(const std::string& server,
-                                            const std::string& market);
+    void levelRows(const OrderBook& book, size_t depth) const;
+    void levelTable(const OrderBook& book, size_t depth) const;
+    std::unique_ptr<OTDB::OfferListMarket> loadMarketOffers(
+        const std::string& server,
+        const std::string& market);
+    void offerRows(const OrderBook& book, size_t depth) const;
+    void offerTable(const OrderBook& book, size_t depth) const;
 };
 
 } // namespace opentxs
@@ -43,13 +43,14 @@
 namespace opentxs
 {
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "--currency <id>"};
+}  // namespace
+
 CmdShowPayable::CmdShowPayable()
 {
-    command = "showpayable";
-    args[0] = "--mynym <nym>";
-    args[1] = "--currency <id>";
-    category = catOtherUsers;
-    help = "Show the list of payable contacts for a currency.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdShowPayable::runWithOptions()
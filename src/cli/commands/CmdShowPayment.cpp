@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "[--index <index>]",
+    "[--showmemo <true|FALSE>]"};
+}  // namespace
+
 CmdShowPayment::CmdShowPayment()
 {
-    command = "showpayment";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "[--index <index>]";
-    args[3] = "[--showmemo <true|FALSE>]";
-    category = catOtherUsers;
-    help = "Show details of an incoming payment in the payments inbox.";
+    setArguments(arguments);
     usage = "Server is an Opentxs Notary where you receive incoming messages (including payments). Default index is 0.";
 }
 
@@ -110,8 +113,8 @@ int32_t CmdShowPayment::run(
         return 0;
     }
 
-    cout << "Idx  Amt   Type       Txn#   Memo\n";
-    cout << "---------------------------------\n";
+    out() << "Idx  Amt   Type       Txn#   Memo\n";
+    out() << "---------------------------------\n";
 
     string payment =
         SwigWrap::Ledger_GetInstrument(server, mynym, mynym, inbox, messageNr);
@@ -159,10 +162,10 @@ int32_t CmdShowPayment::run(
         acct = "A:" + acct + "\n";
     }
 
-    cout << messageNr << "    ";
+    out() << messageNr << "    ";
 
     string fmtAmount = formatAmount(assetType, amount);
-    cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
+    out() << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
 
     if ("" != assetType) {
         string assetName = SwigWrap::GetAssetType_Name(assetType);
@@ -170,13 +173,13 @@ int32_t CmdShowPayment::run(
         assetType = "T:" + assetType + "\n";
     }
 
-    cout << type << (type.size() > 10 ? " " : "    ");
-    cout << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
-    cout << memo << "\n";
-    cout << user;
-    cout << acct;
-    cout << assetType;
-    cout << "Instrument:\n" << payment << "\n";
+    out() << type << (type.size() > 10 ? " " : "    ");
+    out() << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
+    out() << memo << "\n";
+    out() << user;
+    out() << acct;
+    out() << assetType;
+    out() << "Instrument:\n" << payment << "\n";
 
     return 1;
 }
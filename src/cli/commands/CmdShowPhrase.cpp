@@ -46,12 +46,7 @@
 
 namespace opentxs
 {
-CmdShowPhrase::CmdShowPhrase()
-{
-    command = "showphrase";
-    category = catWallet;
-    help = "Show wallet BIP39 passphrase.";
-}
+CmdShowPhrase::CmdShowPhrase() {}
 
 CmdShowPhrase::~CmdShowPhrase() {}
 
@@ -61,7 +56,7 @@ int32_t CmdShowPhrase::run()
 {
     const std::string words = SwigWrap::Wallet_GetPassphrase();
     const bool empty = 1 > words.size();
-    std::cout << words << std::endl;
+    out() << words << "\n";
 
     return empty ? -1 : 0;
 }
@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <id>"};
+}  // namespace
+
 CmdShowProfile::CmdShowProfile()
 {
-    command = "showprofile";
-    args[0] = "--mynym <id>";
-    category = catNyms;
-    help = "Display profile data";
+    setArguments(arguments);
 }
 
 void CmdShowProfile::display_groups(const ui::ProfileSection& section) const
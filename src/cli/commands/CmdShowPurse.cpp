@@ -47,14 +47,17 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--mypurse <purse>"};
+}  // namespace
+
 CmdShowPurse::CmdShowPurse()
 {
-    command = "showpurse";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--mypurse <purse>";
-    category = catWallet;
-    help = "Show contents of a cash purse.";
+    setArguments(arguments);
 }
 
 CmdShowPurse::~CmdShowPurse() {}
@@ -86,7 +89,7 @@ int32_t CmdShowPurse::run(string server, string mynym, string mypurse)
     }
 
     int64_t amount = SwigWrap::Purse_GetTotalValue(server, mypurse, purse);
-    cout << "Total value: " << SwigWrap::FormatAmount(mypurse, amount) << "\n";
+    out() << "Total value: " << formatAmount(mypurse, amount) << "\n";
 
     int32_t items = SwigWrap::Purse_Count(server, mypurse, purse);
     if (0 > items) {
@@ -105,8 +108,8 @@ int32_t CmdShowPurse::run(string server, string mynym, string mypurse)
         return -1;
     }
 
-    cout << "Token count: " << items << "\n";
-    cout << "Index\tValue\tSeries\tValidFrom\tValidTo\t\tStatus\n";
+    out() << "Token count: " << items << "\n";
+    out() << "Index\tValue\tSeries\tValidFrom\tValidTo\t\tStatus\n";
 
     for (int32_t i = 0; i < items; i++) {
         string token = SwigWrap::Purse_Peek(server, mypurse, mynym, purse);
@@ -148,8 +151,8 @@ int32_t CmdShowPurse::run(string server, string mynym, string mypurse)
 
         string status = until < now ? "expired" : "valid";
 
-        cout << i << "\t" << denomination << "\t" << series << "\t" << from
-             << "\t" << until << "\t" << status << "\n";
+        out() << i << "\t" << denomination << "\t" << series << "\t" << from
+              << "\t" << until << "\t" << status << "\n";
     }
 
     return 1;
@@ -38,6 +38,8 @@
 
 #include "CmdShowRecords.hpp"
 
+#include "../LedgerSnapshot.hpp"
+
 #include <opentxs/opentxs.hpp>
 
 #include <stdint.h>
@@ -47,14 +49,23 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "[--server <server>]",
+    "[--mynym <nym>]",
+    "[--myacct <account>]",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+}  // namespace
+
 CmdShowRecords::CmdShowRecords()
 {
-    command = "showrecords";
-    args[0] = "[--server <server>]";
-    args[1] = "[--mynym <nym>]";
-    args[2] = "[--myacct <account>]";
-    category = catMisc;
-    help = "Show contents of record box.";
+    setArguments(arguments);
+    ndjsonRows = true;
     usage = "Specify either one of --server/--mynym and --myacct.";
 }
 
@@ -62,10 +73,20 @@ CmdShowRecords::~CmdShowRecords() {}
 
 int32_t CmdShowRecords::runWithOptions()
 {
-    return run(getOption("server"), getOption("mynym"), getOption("myacct"));
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
+
+    return run(
+        getOption("server"), getOption("mynym"), getOption("myacct"), paging);
 }
 
-int32_t CmdShowRecords::run(string server, string mynym, string myacct)
+int32_t CmdShowRecords::run(
+    string server,
+    string mynym,
+    string myacct,
+    const Paging& paging)
 {
     if ("" == myacct) {
         if (!checkServer("server", server)) {
@@ -104,13 +125,19 @@ int32_t CmdShowRecords::run(string server, string mynym, string myacct)
     // actually done with the records -- they're just there for the actual
     // client to take and store however it wishes.)
 
-    otOut << "Archived Nym-related records (" << mynym << "):\n";
-    bool success = 0 <= showRecords(server, mynym, mynym);
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Archived Nym-related records (" << mynym << "):\n";
+    }
+    bool success = 0 <= showRecords(server, mynym, mynym, paging);
 
     if ("" != myacct) {
-        dashLine();
-        otOut << "Archived Account-related records (" << myacct << "):\n";
-        success |= 0 <= showRecords(server, mynym, myacct);
+        if (!rows) {
+            dashLine();
+            out() << "Archived Account-related records (" << myacct
+                  << "):\n";
+        }
+        success |= 0 <= showRecords(server, mynym, myacct, paging);
     }
 
     return success ? 1 : -1;
@@ -119,65 +146,45 @@ int32_t CmdShowRecords::run(string server, string mynym, string myacct)
 int32_t CmdShowRecords::showRecords(
     const string& server,
     const string& mynym,
-    const string& myacct)
+    const string& myacct,
+    const Paging& paging)
 {
-    string records = SwigWrap::LoadRecordBox(server, mynym, myacct);
-    if ("" == records) {
+    LedgerSnapshot records;
+    if (!records.load(
+            LedgerSnapshot::Box::RecordBox, server, mynym, myacct, paging)) {
         otOut << "Error: cannot load record box.\n";
         return -1;
     }
 
-    int32_t items = SwigWrap::Ledger_GetCount(server, mynym, myacct, records);
-    if (0 > items) {
-        otOut << "Error: cannot load record box item count.\n";
-        return -1;
+    if (0 == records.size()) {
+        otOut << (0 == records.total ? "The record box is empty.\n"
+                                     : "No records in that range.\n");
+        return 0;
     }
 
-    if (0 == items) {
-        otOut << "The record box is empty.\n";
-        return 0;
+    const bool rows = ndjson();
+    if (!rows) {
+        out() << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
+        out() << "---------------------------------|(from or to)\n";
     }
 
-    cout << "Idx  Amt  Type        Txn# InRef#|User / Acct\n";
-    cout << "---------------------------------|(from or to)\n";
-    for (int32_t i = 0; i < items; i++) {
-        string tx = SwigWrap::Ledger_GetTransactionByIndex(
-            server, mynym, myacct, records, i);
-        int64_t txNum = SwigWrap::Ledger_GetTransactionIDByIndex(
-            server, mynym, myacct, records, i);
-        int64_t refNum = SwigWrap::Transaction_GetDisplayReferenceToNum(
-            server, mynym, myacct, tx);
-        int64_t amount =
-            SwigWrap::Transaction_GetAmount(server, mynym, myacct, tx);
-        string type = SwigWrap::Transaction_GetType(server, mynym, myacct, tx);
-        string senderUser =
-            SwigWrap::Transaction_GetSenderNymID(server, mynym, myacct, tx);
-        string senderAcct =
-            SwigWrap::Transaction_GetSenderAcctID(server, mynym, myacct, tx);
-        string recipientUser =
-            SwigWrap::Transaction_GetRecipientNymID(server, mynym, myacct, tx);
-        string recipientAcct =
-            SwigWrap::Transaction_GetRecipientAcctID(server, mynym, myacct, tx);
-
-        string user = "" != senderUser ? senderUser : recipientUser;
-        string acct = "" != senderAcct ? senderAcct : recipientAcct;
-
-        string separator = ("" == user && "" == acct)
-                               ? ""
-                               : "\n                                 |";
-
-        string userDenoter = "" != user ? "U:" : "";
-        string acctDenoter = "" != acct ? "A:" : "";
-
-        string assetType = "" != acct ? getAccountAssetType(acct) : "";
-        string fmtAmount = formatAmount(assetType, amount);
-
-        cout << i << "    ";
-        cout << fmtAmount << (fmtAmount.size() < 3 ? "    " : "   ");
-        cout << type << (type.size() > 10 ? " " : "    ");
-        cout << txNum << (to_string(txNum).size() < 2 ? "    " : "   ");
-        cout << refNum << (to_string(refNum).size() > 2 ? "  " : " ") << "|";
-        cout << userDenoter << user << separator << acctDenoter << acct << "\n";
+    for (size_t i = 0; i < records.size(); i++) {
+        if (rows) {
+            // rows of both record boxes end up in the same stream
+            JsonRow row(out());
+            row.field("box", mynym == myacct ? "nym" : "account")
+                .field("index", static_cast<int64_t>(records.position[i]))
+                .field("date", records.date[i])
+                .field("amount", records.amount[i])
+                .field("type", records.type[i])
+                .field("transaction", records.number[i])
+                .field("in_reference_to", records.reference[i])
+                .field("user", records.user(i))
+                .field("account", records.account(i));
+            continue;
+        }
+
+        receiptLine(records, i, records.user(i), records.account(i));
     }
 
     return 1;
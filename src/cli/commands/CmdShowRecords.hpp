@@ -144,15 +144,21 @@ public:
     EXPORT CmdShowRecords();
     virtual ~CmdShowRecords();
 
-    EXPORT int32_t
-        run(std::string server, std::string mynym, std::string myacct);
+    EXPORT int32_t run(
+        std::string server,
+        std::string mynym,
+        std::string myacct,
+        const Paging& paging = Paging());
 
 protected:
     virtual int32_t runWithOptions();
 
 private:
-    int32_t showRecords(const std::string& server, const std::string& mynym,
-                        const std::string& myacct);
+    int32_t showRecords(
+        const std::string& server,
+        const std::string& mynym,
+        const std::string& myacct,
+        const Paging& paging);
 };
 
 } // namespace opentxs
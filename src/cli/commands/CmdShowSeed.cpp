@@ -46,12 +46,7 @@
 
 namespace opentxs
 {
-CmdShowSeed::CmdShowSeed()
-{
-    command = "showseed";
-    category = catWallet;
-    help = "Show the wallet BIP32 seed as a hex string.";
-}
+CmdShowSeed::CmdShowSeed() {}
 
 CmdShowSeed::~CmdShowSeed() {}
 
@@ -61,7 +56,7 @@ int32_t CmdShowSeed::run()
 {
     const std::string seed = SwigWrap::Wallet_GetSeed();
     const bool empty = 1 > seed.size();
-    std::cout << seed << std::endl;
+    out() << seed << "\n";
 
     return empty ? -1 : 0;
 }
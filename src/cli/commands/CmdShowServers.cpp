@@ -47,12 +47,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdShowServers::CmdShowServers()
-{
-    command = "showservers";
-    category = catWallet;
-    help = "Show the server contracts in the wallet.";
-}
+CmdShowServers::CmdShowServers() {}
 
 CmdShowServers::~CmdShowServers() {}
 
@@ -71,13 +66,13 @@ int32_t CmdShowServers::run()
         return 0;
     }
 
-    cout << " ** SERVERS:\n";
+    out() << " ** SERVERS:\n";
     dashLine();
 
     for (int32_t i = 0; i < items; i++) {
         string server = SwigWrap::GetServer_ID(i);
         string name = SwigWrap::GetServer_Name(server);
-        cout << i << ": " << server << "  -  " << name << "\n";
+        out() << i << ": " << server << "  -  " << name << "\n";
     }
 
     return 1;
@@ -41,24 +41,47 @@
 #include <opentxs/opentxs.hpp>
 
 #include <ctime>
+#include <deque>
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{
+    "--mynym <nym>",
+    "--thread <threadID>",
+    "[--offset <count>]",
+    "[--limit <count>]",
+    "[--since <time>]",
+    "[--until <time>]",
+    "[--reverse]"};
+
+struct Line {
+    std::chrono::system_clock::time_point timestamp;
+    std::string text;
+};
+}  // namespace
+
 CmdShowThread::CmdShowThread()
 {
-    command = "showthread";
-    args[0] = "--mynym <nym>";
-    args[1] = "--thread <threadID>";
-    category = catOtherUsers;
-    help = "Display the contents of an activity thread.";
+    setArguments(arguments);
+    ndjsonRows = true;
 }
 
 std::int32_t CmdShowThread::runWithOptions()
 {
-    return run(getOption("mynym"), getOption("thread"));
+    Paging paging;
+    if (!checkPaging(paging)) {
+        return -1;
+    }
+
+    return run(getOption("mynym"), getOption("thread"), paging);
 }
 
-std::int32_t CmdShowThread::run(std::string mynym, const std::string& threadID)
+std::int32_t CmdShowThread::run(
+    std::string mynym,
+    const std::string& threadID,
+    const Paging& paging)
 {
     if (!checkNym("mynym", mynym)) {
 
@@ -67,23 +90,73 @@ std::int32_t CmdShowThread::run(std::string mynym, const std::string& threadID)
 
     const auto& thread =
         OT::App().UI().ActivityThread(Identifier(mynym), Identifier(threadID));
-    const auto first = thread.First();
-    otOut << thread.DisplayName() << "\n";
+    auto line = thread.First();
+    const bool rows = ndjson();
+    if (!rows) { out() << thread.DisplayName() << "\n"; }
+
+    auto print = [&](
+        const std::chrono::system_clock::time_point timestamp,
+        const std::string& text) {
+        if (rows) {
+            JsonRow row(out());
+            row.field(
+                   "date",
+                   static_cast<std::int64_t>(
+                       std::chrono::system_clock::to_time_t(timestamp)))
+                .field("text", text);
+            return;
+        }
 
-    if (false == first->Valid()) {
+        out() << " * " << time(timestamp) << " " << text << "\n";
+    };
+
+    if (false == line->Valid()) {
         return 0;
     }
 
-    auto last = first->Last();
-    otOut << " * " << time(first->Timestamp()) << " " << first->Text() << "\n";
+    // The thread can only be walked forward, oldest first. Oldest first, the
+    // walk stops once the window is full or past --until; newest first, only
+    // the last offset + limit lines in range are held on to.
+    std::deque<Line> newest;
+    const std::size_t span = paging.span();
+    std::size_t skipped = 0;
+    std::size_t listed = 0;
+
+    while (true) {
+        const auto timestamp = line->Timestamp();
+        const auto seconds = std::chrono::system_clock::to_time_t(timestamp);
+
+        if (false == paging.newestFirst && paging.until <= seconds) {
+            break;
+        }
+
+        if (paging.inRange(seconds)) {
+            if (paging.newestFirst) {
+                if (0 < span) {
+                    newest.push_back({timestamp, line->Text()});
+                    if (span < newest.size()) { newest.pop_front(); }
+                }
+            } else if (skipped < paging.offset) {
+                skipped++;
+            } else {
+                print(timestamp, line->Text());
+                if (paging.limit == ++listed) { break; }
+            }
+        }
+
+        if (line->Last()) { break; }
+        line = thread.Next();
+    }
 
-    while (false == last) {
-        const auto line = thread.Next();
-        last = line->Last();
-        otOut << " * " << time(line->Timestamp()) << " " << line->Text() << "\n";
+    for (auto it = newest.rbegin(); it != newest.rend(); it++) {
+        if (skipped < paging.offset) {
+            skipped++;
+            continue;
+        }
+        print(it->timestamp, it->text);
     }
 
-    otOut << std::endl;
+    if (!rows) { out() << "\n"; }
 
     return 0;
 }
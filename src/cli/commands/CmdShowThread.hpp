@@ -58,7 +58,8 @@ public:
 
     std::int32_t run(
         std::string mynym,
-        const std::string& threadID);
+        const std::string& threadID,
+        const Paging& paging = Paging());
 
     ~CmdShowThread() = default;
 
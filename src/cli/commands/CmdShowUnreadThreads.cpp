@@ -42,13 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdShowUnreadThreads::CmdShowUnreadThreads()
 {
-    command = "showunreadthreads";
-    args[0] = "--mynym <nym>";
-    category = catOtherUsers;
-    help =
-        "List activity threads containing unread items for the specified user.";
+    setArguments(arguments);
 }
 
 std::int32_t CmdShowUnreadThreads::runWithOptions()
@@ -49,12 +49,7 @@
 using namespace opentxs;
 using namespace std;
 
-CmdShowWallet::CmdShowWallet()
-{
-    command = "showwallet";
-    category = catWallet;
-    help = "Show wallet contents.";
-}
+CmdShowWallet::CmdShowWallet() {}
 
 CmdShowWallet::~CmdShowWallet() {}
 
@@ -65,17 +60,17 @@ int32_t CmdShowWallet::run()
     CmdShowServers showServers;
     bool success = 0 <= showServers.run();
 
-    cout << "\n";
+    out() << "\n";
 
     CmdShowNyms showNyms;
     success |= 0 <= showNyms.run();
 
-    cout << "\n";
+    out() << "\n";
 
     CmdShowAssets showAssets;
     success |= 0 <= showAssets.run();
 
-    cout << "\n";
+    out() << "\n";
 
     CmdShowAccounts showAccounts;
     success |= 0 <= showAccounts.run();
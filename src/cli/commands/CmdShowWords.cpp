@@ -46,12 +46,7 @@
 
 namespace opentxs
 {
-CmdShowWords::CmdShowWords()
-{
-    command = "showwords";
-    category = catWallet;
-    help = "Show wallet BIP39 seed as a word list.";
-}
+CmdShowWords::CmdShowWords() {}
 
 CmdShowWords::~CmdShowWords() {}
 
@@ -61,7 +56,7 @@ int32_t CmdShowWords::run()
 {
     const std::string words = SwigWrap::Wallet_GetWords();
     const bool empty = 1 > words.size();
-    std::cout << words << std::endl;
+    out() << words << "\n";
 
     return empty ? -1 : 0;
 }
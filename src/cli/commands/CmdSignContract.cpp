@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>", "[--type <contracttype>]"};
+}  // namespace
+
 CmdSignContract::CmdSignContract()
 {
-    command = "signcontract";
-    args[0] = "--mynym <nym>";
-    args[1] = "[--type <contracttype>]";
-    category = catAdmin;
-    help = "Add a signature to a contract and erase all others";
+    setArguments(arguments);
     usage = "If --type is specified, flatsign the contract using that type.";
 }
 
@@ -91,7 +92,7 @@ int32_t CmdSignContract::run(string mynym, string type)
     }
 
     dashLine();
-    cout << "Signed:\n" << output << "\n";
+    out() << "Signed:\n" << output << "\n";
 
     return 1;
 }
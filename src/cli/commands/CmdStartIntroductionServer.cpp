@@ -42,12 +42,14 @@
 
 namespace opentxs
 {
+namespace
+{
+constexpr Arguments arguments{"--mynym <nym>"};
+}  // namespace
+
 CmdStartIntroductionServer::CmdStartIntroductionServer()
 {
-    command = "startintroductionserver";
-    args[0] = "--mynym <nym>";
-    category = catWallet;
-    help = "Initialize state machine for the introduction server";
+    setArguments(arguments);
 }
 
 std::int32_t CmdStartIntroductionServer::runWithOptions()
@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "--hisacct <account>",
+    "--amount <amount>",
+    "[--memo <memoline>]"};
+}  // namespace
+
 CmdTransfer::CmdTransfer()
 {
-    command = "transfer";
-    args[0] = "--myacct <account>";
-    args[1] = "--hisacct <account>";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    category = catAccounts;
-    help = "Send a transfer from myacct to hisacct.";
+    setArguments(arguments);
 }
 
 CmdTransfer::~CmdTransfer() {}
@@ -143,8 +146,11 @@ int32_t CmdTransfer::run(
     }
 
     {
-        if (!OT::App().API().ServerAction().DownloadAccount(
-                Identifier(mynym), Identifier(server), Identifier(myacct), true)) {
+        if (!downloadAccount(
+                Identifier(mynym),
+                Identifier(server),
+                Identifier(myacct),
+                true)) {
             otOut << "Error retrieving intermediary files for account.\n";
             return -1;
         }
@@ -46,17 +46,20 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--id <transactionnr>",
+    "--clause <clausename>",
+    "[--param <parameter>]"};
+}  // namespace
+
 CmdTriggerClause::CmdTriggerClause()
 {
-    command = "triggerclause";
     // FIX many more args
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--id <transactionnr>";
-    args[3] = "--clause <clausename>";
-    args[4] = "[--param <parameter>]";
-    category = catInstruments;
-    help = "Trigger a clause on a running smart contract.";
+    setArguments(arguments);
 }
 
 CmdTriggerClause::~CmdTriggerClause() {}
@@ -108,16 +111,16 @@ int32_t CmdTriggerClause::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .TriggerClause(
-                              Identifier(mynym),
-                              Identifier(server),
-                              std::stoi(id),
-                              clause,
-                              param)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .TriggerClause(
+                    Identifier(mynym),
+                    Identifier(server),
+                    std::stoi(id),
+                    clause,
+                    param));
     }
     return processResponse(response, "trigger clause");
 }
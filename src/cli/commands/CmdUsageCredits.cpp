@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--server <server>",
+    "--mynym <nym>",
+    "--hisnym <nym>",
+    "--adjust <usagecredits>"};
+}  // namespace
+
 CmdUsageCredits::CmdUsageCredits()
 {
-    command = "usagecredits";
-    args[0] = "--server <server>";
-    args[1] = "--mynym <nym>";
-    args[2] = "--hisnym <nym>";
-    args[3] = "--adjust <usagecredits>";
-    category = catOtherUsers;
-    help = "Give or take away hisnym's usage credits.";
+    setArguments(arguments);
     usage = "Mynym can use this on himself, read-only.";
 }
 
@@ -95,15 +98,15 @@ int32_t CmdUsageCredits::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .AdjustUsageCredits(
-                              Identifier(mynym),
-                              Identifier(server),
-                              Identifier(hisnym),
-                              std::stoll(adjust))
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .AdjustUsageCredits(
+                    Identifier(mynym),
+                    Identifier(server),
+                    Identifier(hisnym),
+                    std::stoll(adjust)));
     }
     if (1 != processResponse(response, "adjust usage credits")) {
         return -1;
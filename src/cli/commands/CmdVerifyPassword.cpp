@@ -43,12 +43,7 @@
 namespace opentxs
 {
 
-CmdVerifyPassword::CmdVerifyPassword()
-{
-    command = "verifypassword";
-    category = catWallet;
-    help = "Prompt for wallet passphrase entry.";
-}
+CmdVerifyPassword::CmdVerifyPassword() {}
 
 std::int32_t CmdVerifyPassword::runWithOptions() { return run(); }
 
@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--server <server>", "--myacct <account>"};
+}  // namespace
+
 CmdVerifyReceipt::CmdVerifyReceipt()
 {
-    command = "verifyreceipt";
-    args[0] = "--server <server>";
-    args[1] = "--myacct <account>";
-    category = catAccounts;
-    help = "Verify your intermediary files against last signed receipt.";
+    setArguments(arguments);
 }
 
 CmdVerifyReceipt::~CmdVerifyReceipt() {}
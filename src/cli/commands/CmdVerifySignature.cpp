@@ -47,12 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--hisnym <nym>"};
+}  // namespace
+
 CmdVerifySignature::CmdVerifySignature()
 {
-    command = "verifysignature";
-    args[0] = "--hisnym <nym>";
-    category = catAdmin;
-    help = "Verify hisnym's signature on a pasted contract.";
+    setArguments(arguments);
 }
 
 CmdVerifySignature::~CmdVerifySignature() {}
@@ -78,7 +80,7 @@ int32_t CmdVerifySignature::run(string hisnym)
         return -1;
     }
 
-    cout << "Signature was verified!\n";
+    out() << "Signature was verified!\n";
 
     return 1;
 }
@@ -47,13 +47,14 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{"--myacct <account>", "--amount <amount>"};
+}  // namespace
+
 CmdWithdrawCash::CmdWithdrawCash()
 {
-    command = "withdraw";
-    args[0] = "--myacct <account>";
-    args[1] = "--amount <amount>";
-    category = catInstruments;
-    help = "Withdraw from myacct as cash into local purse.";
+    setArguments(arguments);
 }
 
 CmdWithdrawCash::~CmdWithdrawCash() {}
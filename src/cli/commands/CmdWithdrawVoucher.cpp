@@ -47,15 +47,18 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "--hisnym <nym>",
+    "--amount <amount>",
+    "[--memo <memoline>]"};
+}  // namespace
+
 CmdWithdrawVoucher::CmdWithdrawVoucher()
 {
-    command = "withdrawvoucher";
-    args[0] = "--myacct <account>";
-    args[1] = "--hisnym <nym>";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    category = catInstruments;
-    help = "Withdraw from myacct as a voucher (cashier's cheque).";
+    setArguments(arguments);
     usage = "Use sendvoucher if you want to send it immediately.";
 }
 
@@ -81,7 +84,7 @@ int32_t CmdWithdrawVoucher::run(
         return -1;
     }
 
-    cout << voucher << "\n";
+    out() << voucher << "\n";
 
     return 1;
 }
@@ -122,17 +125,17 @@ int32_t CmdWithdrawVoucher::run(
 
     std::string response;
     {
-        response = OT::App()
-                          .API()
-                          .ServerAction()
-                          .WithdrawVoucher(
-                              theNymID,
-                              theNotaryID,
-                              theAcctID,
-                              Identifier(hisnym),
-                              value,
-                              memo)
-                          ->Run();
+        response = notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .WithdrawVoucher(
+                    theNymID,
+                    theNotaryID,
+                    theAcctID,
+                    Identifier(hisnym),
+                    value,
+                    memo));
     }
     int32_t reply =
         responseReply(response, server, mynym, myacct, "withdraw_voucher");
@@ -169,12 +172,12 @@ int32_t CmdWithdrawVoucher::run(
     // safe-keeping.
     auto payment = std::make_shared<const OTPayment>(String(voucher.c_str()));
     {
-        OT::App()
-            .API()
-            .ServerAction()
-            .SendPayment(theNymID, theNotaryID, theNymID, payment)
-            ->Run();
-        if (!OT::App().API().ServerAction().DownloadAccount(
+        notaryRun(
+            OT::App()
+                .API()
+                .ServerAction()
+                .SendPayment(theNymID, theNotaryID, theNymID, payment));
+        if (!downloadAccount(
                 theNymID, theNotaryID, theAcctID, true)) {
             otOut << "Error retrieving intermediary files for account.\n";
             return -1;
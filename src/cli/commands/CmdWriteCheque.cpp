@@ -45,16 +45,19 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--hisnym <nym>]",
+    "--amount <amount>",
+    "[--memo <memoline>]",
+    "[--validfor <seconds>]"};
+}  // namespace
+
 CmdWriteCheque::CmdWriteCheque()
 {
-    command = "writecheque";
-    args[0] = "--myacct <account>";
-    args[1] = "[--hisnym <nym>]";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    args[4] = "[--validfor <seconds>]";
-    category = catInstruments;
-    help = "Write a cheque and print it out to the screen.";
+    setArguments(arguments);
     usage = "Use sendcheque if you want to write AND send the cheque.";
 }
 
@@ -82,7 +85,7 @@ int32_t CmdWriteCheque::run(
         return -1;
     }
 
-    cout << cheque << "\n";
+    out() << cheque << "\n";
 
     return 1;
 }
@@ -45,16 +45,19 @@
 using namespace opentxs;
 using namespace std;
 
+namespace
+{
+constexpr Arguments arguments{
+    "--myacct <account>",
+    "[--hisnym <nym>]",
+    "--amount <amount>",
+    "[--memo <memoline>]",
+    "[--validfor <seconds>]"};
+}  // namespace
+
 CmdWriteInvoice::CmdWriteInvoice()
 {
-    command = "writeinvoice";
-    args[0] = "--myacct <account>";
-    args[1] = "[--hisnym <nym>]";
-    args[2] = "--amount <amount>";
-    args[3] = "[--memo <memoline>]";
-    args[4] = "[--validfor <seconds>]";
-    category = catInstruments;
-    help = "Write an invoice and print it out to the screen.";
+    setArguments(arguments);
     usage = "Use sendinvoice if you want to write AND send the cheque.";
 }
 
@@ -82,7 +85,7 @@ int32_t CmdWriteInvoice::run(
         return -1;
     }
 
-    cout << cheque << "\n";
+    out() << cheque << "\n";
 
     return 1;
 }
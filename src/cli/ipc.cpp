@@ -0,0 +1,259 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "ipc.hpp"
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// keeps a single request from making the daemon allocate unbounded memory
+const uint32_t MAX_ARGUMENTS = 1024;
+const uint32_t MAX_ARGUMENT_LENGTH = 1024 * 1024;
+
+bool make_address(const string& path, sockaddr_un& address)
+{
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.length() >= sizeof(address.sun_path)) { return false; }
+    memcpy(address.sun_path, path.c_str(), path.length());
+    return true;
+}
+}  // namespace
+
+string Ipc::defaultSocket()
+{
+    const char* env = getenv("OPENTXS_CLI_SOCKET");
+    if (nullptr != env && '\0' != env[0]) { return env; }
+
+    const char* home = getenv("HOME");
+    if (nullptr == home || '\0' == home[0]) { return ""; }
+
+    return string(home) + "/.ot/opentxs-cli.sock";
+}
+
+int Ipc::listenOn(const string& path)
+{
+    sockaddr_un address;
+    if (!make_address(path, address)) { return -1; }
+
+    // a socket file left behind by a daemon that is no longer running
+    // would make bind() fail, but never remove one that is still in use
+    int probe = connectTo(path);
+    if (0 <= probe) {
+        close(probe);
+        errno = EADDRINUSE;
+        return -1;
+    }
+    unlink(path.c_str());
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (0 > sock) { return -1; }
+
+    // the daemon runs commands with the owner's wallet, so nobody else
+    // may connect to it
+    mode_t mask = umask(0177);
+    int bound = ::bind(
+        sock, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    umask(mask);
+
+    if (0 != bound || 0 != listen(sock, 16)) {
+        close(sock);
+        return -1;
+    }
+
+    return sock;
+}
+
+int Ipc::connectTo(const string& path)
+{
+    sockaddr_un address;
+    if (!make_address(path, address)) { return -1; }
+
+    int sock = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (0 > sock) { return -1; }
+
+    if (0 != connect(
+                 sock,
+                 reinterpret_cast<sockaddr*>(&address),
+                 sizeof(address))) {
+        close(sock);
+        return -1;
+    }
+
+    return sock;
+}
+
+bool Ipc::sendRequest(int sock, const vector<string>& args)
+{
+    uint32_t count = args.size();
+
+    // the argument count travels together with the descriptors
+    iovec payload;
+    payload.iov_base = &count;
+    payload.iov_len = sizeof(count);
+
+    char control[CMSG_SPACE(sizeof(int) * STREAMS)];
+    memset(control, 0, sizeof(control));
+
+    msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int) * STREAMS);
+    int fds[STREAMS] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+    memcpy(CMSG_DATA(header), fds, sizeof(fds));
+
+    if (static_cast<ssize_t>(sizeof(count)) != sendmsg(sock, &message, 0)) {
+        return false;
+    }
+
+    for (const auto& arg : args) {
+        uint32_t length = arg.length();
+        if (!writeAll(sock, &length, sizeof(length)) ||
+            !writeAll(sock, arg.data(), length)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool Ipc::receiveRequest(int sock, vector<string>& args, int fds[STREAMS])
+{
+    for (int i = 0; i < STREAMS; i++) { fds[i] = -1; }
+
+    uint32_t count = 0;
+    iovec payload;
+    payload.iov_base = &count;
+    payload.iov_len = sizeof(count);
+
+    char control[CMSG_SPACE(sizeof(int) * STREAMS)];
+    memset(control, 0, sizeof(control));
+
+    msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    if (static_cast<ssize_t>(sizeof(count)) != recvmsg(sock, &message, 0)) {
+        return false;
+    }
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    if (nullptr == header || SOL_SOCKET != header->cmsg_level ||
+        SCM_RIGHTS != header->cmsg_type ||
+        CMSG_LEN(sizeof(int) * STREAMS) != header->cmsg_len) {
+        return false;
+    }
+    memcpy(fds, CMSG_DATA(header), sizeof(int) * STREAMS);
+
+    if (0 == count || MAX_ARGUMENTS < count) { return false; }
+
+    args.clear();
+    args.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t length = 0;
+        if (!readAll(sock, &length, sizeof(length)) ||
+            MAX_ARGUMENT_LENGTH < length) {
+            return false;
+        }
+        string arg(length, '\0');
+        if (!readAll(sock, &arg[0], length)) { return false; }
+        args.push_back(arg);
+    }
+
+    return true;
+}
+
+bool Ipc::sendStatus(int sock, int32_t status)
+{
+    return writeAll(sock, &status, sizeof(status));
+}
+
+bool Ipc::receiveStatus(int sock, int32_t& status)
+{
+    return readAll(sock, &status, sizeof(status));
+}
+
+bool Ipc::readAll(int sock, void* data, size_t size)
+{
+    char* buf = static_cast<char*>(data);
+    while (0 < size) {
+        ssize_t got = read(sock, buf, size);
+        if (0 > got && EINTR == errno) { continue; }
+        if (0 >= got) { return false; }
+        buf += got;
+        size -= got;
+    }
+    return true;
+}
+
+bool Ipc::writeAll(int sock, const void* data, size_t size)
+{
+    const char* buf = static_cast<const char*>(data);
+    while (0 < size) {
+        ssize_t put = write(sock, buf, size);
+        if (0 > put && EINTR == errno) { continue; }
+        if (0 >= put) { return false; }
+        buf += put;
+        size -= put;
+    }
+    return true;
+}
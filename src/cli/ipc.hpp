@@ -0,0 +1,88 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_IPC_HPP__
+#define __OPENTXS_IPC_HPP__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace opentxs
+{
+
+// Wire protocol spoken between "opentxs --daemon" and the opentxs-client
+// thin client over a local unix domain socket.
+//
+// request:  the client's stdin/stdout/stderr descriptors (SCM_RIGHTS),
+//           followed by the argument count and each argument, every one
+//           prefixed by its length as a uint32_t
+// response: the int32_t exit code of the command, sent after all output
+//           has been written directly to the client's own descriptors
+class Ipc
+{
+public:
+    static const int STREAMS = 3;
+    // seconds the daemon waits for a connected client to send its request;
+    // it serves one client at a time, so a silent one would block the rest
+    static const int REQUEST_TIMEOUT = 10;
+
+    // OPENTXS_CLI_SOCKET, or opentxs-cli.sock in ~/.ot. The daemon and the
+    // thin client both use it, so it must not depend on anything only the
+    // daemon knows, such as a data folder moved elsewhere. Empty when
+    // neither variable is set.
+    static std::string defaultSocket();
+
+    static int listenOn(const std::string& path);
+    static int connectTo(const std::string& path);
+
+    static bool sendRequest(int sock, const std::vector<std::string>& args);
+    static bool receiveRequest(
+        int sock,
+        std::vector<std::string>& args,
+        int fds[STREAMS]);
+
+    static bool sendStatus(int sock, int32_t status);
+    static bool receiveStatus(int sock, int32_t& status);
+
+private:
+    static bool readAll(int sock, void* data, size_t size);
+    static bool writeAll(int sock, const void* data, size_t size);
+};
+}  // namespace opentxs
+#endif  // __OPENTXS_IPC_HPP__
@@ -36,20 +36,41 @@
  *
  ************************************************************/
 
+#include "CommandStats.hpp"
+#include "CompletionIndex.hpp"
+#include "MainOption.hpp"
+#include "StartupProfile.hpp"
+#include "Trace.hpp"
 #include "opentxs.hpp"
 #include "opentxs/OT.hpp"
 
+#include <string>
+
 using namespace opentxs;
 
 int main(int argc, char* argv[])
 {
+    // needs no client, the build runs it to generate the completion index
+    std::string indexPath;
+    if (takeMainOption(argc, argv, "completion-index", indexPath)) {
+        return CompletionIndex::write(indexPath) ? 0 : -1;
+    }
+
+    StartupProfile::enable(argc, argv);
+    CommandStats::enable(argc, argv);
+    Trace::enable(argc, argv);
+
     OT::ClientFactory({});
+    StartupProfile::mark("client factory");
 
     int returnValue = 0;
     {
         Opentxs opentxsCLI;
+        StartupProfile::mark("cli constructor");
         returnValue = opentxsCLI.run(argc, argv);
     }
+    CommandStats::report();
+    Trace::write();
     OT::Cleanup();
     return returnValue;
 }
@@ -38,176 +38,55 @@
 
 #include "opentxs.hpp"
 
-#include "commands/CmdAcceptAll.hpp"
-#include "commands/CmdAcceptInbox.hpp"
-#include "commands/CmdAcceptIncoming.hpp"
-#include "commands/CmdAcceptInvoices.hpp"
-#include "commands/CmdAcceptMoney.hpp"
-#include "commands/CmdAcceptPayments.hpp"
-#include "commands/CmdAcceptReceipts.hpp"
-#include "commands/CmdAcceptTransfers.hpp"
-#include "commands/CmdAcknowledgeBailment.hpp"
-#include "commands/CmdAcknowledgeConnection.hpp"
-#include "commands/CmdAcknowledgeNotice.hpp"
-#include "commands/CmdAcknowledgeOutBailment.hpp"
-#include "commands/CmdActivitySummary.hpp"
-#include "commands/CmdAddAsset.hpp"
-#include "commands/CmdAddBitcoinAccount.hpp"
-#include "commands/CmdAddContact.hpp"
-#include "commands/CmdAddContract.hpp"
-#include "commands/CmdAddServer.hpp"
-#include "commands/CmdAddSignature.hpp"
-#include "commands/CmdAllocateBitcoinAddress.hpp"
-#include "commands/CmdArchivePeerReply.hpp"
-#include "commands/CmdAssignBitcoinAddress.hpp"
+#include "CmdRegistry.hpp"
+#include "CommandStats.hpp"
+#include "CompletionIndex.hpp"
+#include "MainOption.hpp"
+#include "OptionsFile.hpp"
+#include "OutputCapture.hpp"
+#include "Resolver.hpp"
+#include "ScriptCompiler.hpp"
+#include "StartupProfile.hpp"
+#include "Trace.hpp"
+#include "UnitCache.hpp"
 #include "commands/CmdBase.hpp"
-#include "commands/CmdCanMessage.hpp"
-#include "commands/CmdCancel.hpp"
-#include "commands/CmdChangePw.hpp"
-#include "commands/CmdCheckNym.hpp"
-#include "commands/CmdClearExpired.hpp"
-#include "commands/CmdClearRecords.hpp"
-#include "commands/CmdConfirm.hpp"
-#include "commands/CmdContactName.hpp"
-#include "commands/CmdConvertPaymentCode.hpp"
-#include "commands/CmdDecode.hpp"
-#include "commands/CmdDecrypt.hpp"
-#include "commands/CmdDeposit.hpp"
-#include "commands/CmdDepositCheques.hpp"
-#include "commands/CmdDiscard.hpp"
-#include "commands/CmdEditAccount.hpp"
-#include "commands/CmdEditAsset.hpp"
-#include "commands/CmdEditNym.hpp"
-#include "commands/CmdEditServer.hpp"
-#include "commands/CmdEncode.hpp"
-#include "commands/CmdEncrypt.hpp"
-#include "commands/CmdExchangeBasket.hpp"
-#include "commands/CmdExportCash.hpp"
-#include "commands/CmdExportNym.hpp"
-#include "commands/CmdFindNym.hpp"
-#include "commands/CmdFindServer.hpp"
-#include "commands/CmdGetContact.hpp"
-#include "commands/CmdGetContract.hpp"
-#include "commands/CmdGetMarkets.hpp"
-#include "commands/CmdGetMyOffers.hpp"
-#include "commands/CmdGetOffers.hpp"
-#include "commands/CmdGetPeerReplies.hpp"
-#include "commands/CmdGetPeerReply.hpp"
-#include "commands/CmdGetPeerRequest.hpp"
-#include "commands/CmdGetPeerRequests.hpp"
-#include "commands/CmdGetReceipt.hpp"
-#include "commands/CmdHaveContact.hpp"
-#include "commands/CmdImportCash.hpp"
-#include "commands/CmdImportNym.hpp"
-#include "commands/CmdImportOtherNym.hpp"
-#include "commands/CmdImportPublicNym.hpp"
-#include "commands/CmdImportSeed.hpp"
-#include "commands/CmdInbox.hpp"
-#include "commands/CmdInpayments.hpp"
-#include "commands/CmdIssueAsset.hpp"
-#include "commands/CmdKillOffer.hpp"
-#include "commands/CmdKillPlan.hpp"
-#include "commands/CmdMarkRead.hpp"
-#include "commands/CmdMarkUnRead.hpp"
-#include "commands/CmdMergeContact.hpp"
-#include "commands/CmdModifyNym.hpp"
-#include "commands/CmdNewAccount.hpp"
-#include "commands/CmdNewAsset.hpp"
-#include "commands/CmdNewBasket.hpp"
-#include "commands/CmdNewKey.hpp"
-#include "commands/CmdNewNymHD.hpp"
-#include "commands/CmdNewNymLegacy.hpp"
-#include "commands/CmdNewOffer.hpp"
-#include "commands/CmdNotifyBailment.hpp"
-#include "commands/CmdOutbox.hpp"
-#include "commands/CmdOutpayment.hpp"
-#include "commands/CmdPairNode.hpp"
-#include "commands/CmdPairStatus.hpp"
-#include "commands/CmdPasswordDecrypt.hpp"
-#include "commands/CmdPasswordEncrypt.hpp"
-#include "commands/CmdPayDividend.hpp"
-#include "commands/CmdPayInvoice.hpp"
-#include "commands/CmdPeerStoreSecret.hpp"
-#include "commands/CmdPingNotary.hpp"
-#include "commands/CmdPreloadActivity.hpp"
-#include "commands/CmdPreloadThread.hpp"
-#include "commands/CmdProposePlan.hpp"
-#include "commands/CmdRefresh.hpp"
-#include "commands/CmdRefreshAccount.hpp"
-#include "commands/CmdRefreshAll.hpp"
-#include "commands/CmdRefreshNym.hpp"
-#include "commands/CmdRegisterContractNym.hpp"
-#include "commands/CmdRegisterContractServer.hpp"
-#include "commands/CmdRegisterContractUnit.hpp"
-#include "commands/CmdRegisterNym.hpp"
-#include "commands/CmdRenameNym.hpp"
-#include "commands/CmdRequestAdmin.hpp"
-#include "commands/CmdRequestBailment.hpp"
-#include "commands/CmdRequestConnection.hpp"
-#include "commands/CmdRequestOutBailment.hpp"
-#include "commands/CmdSendCash.hpp"
-#include "commands/CmdSendCheque.hpp"
-#include "commands/CmdSendInvoice.hpp"
-#include "commands/CmdSendMessage.hpp"
-#include "commands/CmdSendVoucher.hpp"
-#include "commands/CmdServerAddClaim.hpp"
-#include "commands/CmdSetProfileValue.hpp"
-#include "commands/CmdShowAccount.hpp"
-#include "commands/CmdShowAccounts.hpp"
-#include "commands/CmdShowActive.hpp"
-#include "commands/CmdShowAssets.hpp"
-#include "commands/CmdShowBalance.hpp"
-#include "commands/CmdShowBasket.hpp"
-#include "commands/CmdShowContact.hpp"
-#include "commands/CmdShowContacts.hpp"
-#include "commands/CmdShowCredential.hpp"
-#include "commands/CmdShowCredentials.hpp"
-#include "commands/CmdShowExpired.hpp"
-#include "commands/CmdShowMarkets.hpp"
-#include "commands/CmdShowMessagable.hpp"
-#include "commands/CmdShowMint.hpp"
-#include "commands/CmdShowMyOffers.hpp"
-#include "commands/CmdShowNym.hpp"
-#include "commands/CmdShowNyms.hpp"
-#include "commands/CmdShowOffers.hpp"
-#include "commands/CmdShowPayable.hpp"
-#include "commands/CmdShowPayment.hpp"
-#include "commands/CmdShowPhrase.hpp"
-#include "commands/CmdShowProfile.hpp"
-#include "commands/CmdShowPurse.hpp"
-#include "commands/CmdShowRecords.hpp"
-#include "commands/CmdShowSeed.hpp"
-#include "commands/CmdShowServers.hpp"
-#include "commands/CmdShowThread.hpp"
-#include "commands/CmdShowThreads.hpp"
-#include "commands/CmdShowUnreadThreads.hpp"
-#include "commands/CmdShowWallet.hpp"
-#include "commands/CmdShowWords.hpp"
-#include "commands/CmdSignContract.hpp"
-#include "commands/CmdStartIntroductionServer.hpp"
-#include "commands/CmdTransfer.hpp"
-#include "commands/CmdTriggerClause.hpp"
-#include "commands/CmdUsageCredits.hpp"
-#include "commands/CmdVerifyPassword.hpp"
-#include "commands/CmdVerifyReceipt.hpp"
-#include "commands/CmdVerifySignature.hpp"
-#include "commands/CmdWithdrawCash.hpp"
-#include "commands/CmdWithdrawVoucher.hpp"
-#include "commands/CmdWriteCheque.hpp"
-#include "commands/CmdWriteInvoice.hpp"
+#ifndef _WIN32
+#include "ipc.hpp"
+#endif
 
 #include <anyoption/anyoption.hpp>
 #include <opentxs/opentxs.hpp>
 
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -226,188 +105,62 @@ const char* categoryName[] = {"Category Error",
                               "Pseudonyms",
                               "Blockchain"};
 
-Opentxs::Opentxs()
-    : newArgc(0)
-    , newArgv(nullptr)
-    , expectFailure(false)
-    , cmds_{new CmdAcceptAll,
-            new CmdAcceptInbox,
-            new CmdAcceptIncoming,
-            new CmdAcceptInvoices,
-            new CmdAcceptMoney,
-            new CmdAcceptPayments,
-            new CmdAcceptReceipts,
-            new CmdAcceptTransfers,
-            new CmdAcknowledgeBailment,
-            new CmdAcknowledgeConnection,
-            new CmdAcknowledgeNotice,
-            new CmdAcknowledgeOutBailment,
-            new CmdActivitySummary,
-            new CmdAddAsset,
-            new CmdAddBitcoinAccount,
-            new CmdAddContact,
-            new CmdAddContract,
-            new CmdAddServer,
-            new CmdAddSignature,
-            new CmdAllocateBitcoinAddress,
-            new CmdArchivePeerReply,
-            new CmdAssignBitcoinAddress,
-            new CmdCancel,
-            new CmdCanMessage,
-            new CmdChangePw,
-            new CmdCheckNym,
-            new CmdClearExpired,
-            new CmdClearRecords,
-            new CmdConfirm,
-            new CmdContactName,
-            new CmdConvertPaymentCode,
-            new CmdDecode,
-            new CmdDecrypt,
-            new CmdDeposit,
-            new CmdDepositCheques,
-            new CmdDiscard,
-            new CmdEditAccount,
-            new CmdEditAsset,
-            new CmdEditNym,
-            new CmdEditServer,
-            new CmdEncode,
-            new CmdEncrypt,
-            new CmdExchangeBasket,
-            new CmdExportCash,
-            new CmdExportNym,
-            new CmdFindNym,
-            new CmdFindServer,
-            new CmdGetContact,
-            new CmdGetInstrumentDefinition,
-            new CmdGetMarkets,
-            new CmdGetMyOffers,
-            new CmdGetOffers,
-            new CmdGetPeerRequests,
-            new CmdGetPeerRequest,
-            new CmdGetPeerReplies,
-            new CmdGetPeerReply,
-            new CmdGetReceipt,
-            new CmdHaveContact,
-            new CmdImportCash,
-            new CmdImportNym,
-            new CmdImportPublicNym,
-            new CmdImportSeed,
-            new CmdInbox,
-            new CmdInpayments,
-            new CmdIssueAsset,
-            new CmdKillOffer,
-            new CmdKillPlan,
-            new CmdMarkRead,
-            new CmdMarkUnRead,
-            new CmdMergeContact,
-            new CmdModifyNym,
-            new CmdNewAccount,
-            new CmdNewAsset,
-            new CmdNewKey,
-            new CmdNewNymHD,
-            new CmdNewNymLegacy,
-            new CmdNewOffer,
-            new CmdNotifyBailment,
-            new CmdImportOtherNym,
-            new CmdOutbox,
-            new CmdNewBasket,
-            new CmdOutpayment,
-            new CmdPairNode,
-            new CmdPairStatus,
-            new CmdPasswordDecrypt,
-            new CmdPasswordEncrypt,
-            new CmdPayDividend,
-            new CmdPayInvoice,
-            new CmdPeerStoreSecret,
-            new CmdPingNotary,
-            new CmdPreloadActivity,
-            new CmdPreloadThread,
-            new CmdProposePlan,
-            new CmdRefresh,
-            new CmdRefreshAccount,
-            new CmdRefreshAll,
-            new CmdRefreshNym,
-            new CmdRenameNym,
-            new CmdRequestAdmin,
-            new CmdRequestBailment,
-            new CmdRequestConnection,
-            new CmdRequestOutBailment,
-            new CmdRegisterContractNym,
-            new CmdRegisterContractServer,
-            new CmdRegisterContractUnit,
-            new CmdRegisterNym,
-            new CmdSendCash,
-            new CmdSendCheque,
-            new CmdSendInvoice,
-            new CmdSendMessage,
-            new CmdSendVoucher,
-            new CmdServerAddClaim,
-            new CmdSetProfileValue,
-            new CmdShowAccount,
-            new CmdShowAccounts,
-            new CmdShowActive,
-            new CmdShowAssets,
-            new CmdShowBalance,
-            new CmdShowBasket,
-            new CmdShowContact,
-            new CmdShowContacts,
-            new CmdShowCredential,
-            new CmdShowCredentials,
-            new CmdShowExpired,
-            new CmdShowMarkets,
-            new CmdShowMessagable,
-            new CmdShowMint,
-            new CmdShowMyOffers,
-            new CmdShowNym,
-            new CmdShowNyms,
-            new CmdShowOffers,
-            new CmdShowPayable,
-            new CmdShowPayment,
-            new CmdShowProfile,
-            new CmdShowPhrase,
-            new CmdShowRecords,
-            new CmdShowPurse,
-            new CmdShowSeed,
-            new CmdShowServers,
-            new CmdShowThread,
-            new CmdShowThreads,
-            new CmdShowUnreadThreads,
-            new CmdShowWallet,
-            new CmdShowWords,
-            new CmdSignContract,
-            new CmdStartIntroductionServer,
-            new CmdTransfer,
-            new CmdTriggerClause,
-            new CmdUsageCredits,
-            new CmdVerifyPassword,
-            new CmdVerifyReceipt,
-            new CmdVerifySignature,
-            new CmdWithdrawCash,
-            new CmdWithdrawVoucher,
-            new CmdWriteCheque,
-            new CmdWriteInvoice}
+namespace
 {
+// options AnyOption takes a value for on any command line, whether or not
+// the command has such an argument
+const char* const COMMON_OPTIONS[] = {"args",
+                                      "myacct",
+                                      "mynym",
+                                      "mypurse",
+                                      "hisacct",
+                                      "hisnym",
+                                      "hispurse",
+                                      "server",
+                                      nullptr};
+
+bool inList(const char* const list[], string_view name)
+{
+    for (int i = 0; nullptr != list[i]; i++) {
+        if (name == list[i]) { return true; }
+    }
+    return false;
 }
 
-Opentxs::~Opentxs() {}
+// main options that take no value
+bool isFlag(string_view name) { return inList(GLOBAL_FLAGS, name); }
 
-string& Opentxs::ltrim(string& s)
+// main options that take a value
+bool isOption(string_view name)
 {
-    s.erase(
-        s.begin(),
-        find_if(s.begin(), s.end(), not1(ptr_fun<int, int>(isspace))));
-    return s;
+    return inList(GLOBAL_OPTIONS, name) || inList(COMMON_OPTIONS, name);
 }
 
-string& Opentxs::rtrim(string& s)
+// a script given as /dev/stdin or the like
+bool isStdin(const char* path)
 {
-    s.erase(
-        find_if(s.rbegin(), s.rend(), not1(ptr_fun<int, int>(isspace))).base(),
-        s.end());
-    return s;
+#ifdef _WIN32
+    return false;
+#else
+    struct stat script, in;
+    return 0 == stat(path, &script) && 0 == fstat(STDIN_FILENO, &in) &&
+           script.st_dev == in.st_dev && script.st_ino == in.st_ino;
+#endif
 }
+}  // namespace
+
+#ifndef _WIN32
+namespace
+{
+volatile sig_atomic_t stopDaemon = 0;
+
+extern "C" void handleStopSignal(int) { stopDaemon = 1; }
+}  // namespace
+#endif
+
+Opentxs::Opentxs() {}
 
-string& Opentxs::trim(string& s) { return ltrim(rtrim(s)); }
+Opentxs::~Opentxs() {}
 
 const char* Opentxs::getOption(
     AnyOption& opt,
@@ -423,7 +176,7 @@ const char* Opentxs::getOption(
 
     // can we get the default value from the options file?
     if (nullptr != defaultName) {
-        value = opt.getValue(defaultName);
+        value = optionsFile_.get(defaultName);
         if (value != nullptr) {
             otWarn << "Default " << optionName << ": " << value << "\n";
             return value;
@@ -436,48 +189,22 @@ const char* Opentxs::getOption(
 
 void Opentxs::loadOptions(AnyOption& opt)
 {
-    String configPath(OTPaths::AppDataFolder());
-    bool configPathFound = configPath.Exists() && 3 < configPath.GetLength();
-    OT_ASSERT_MSG(
-        configPathFound,
-        "RegisterAPIWithScript: Must set Config Path first!\n");
-    otWarn << "Using configuration path: " << configPath << "\n";
-
     opt.addUsage("");
     opt.addUsage(" Opentxs CLI Usage:  ");
     opt.addUsage("");
 
-    opt.setCommandFlag("echocommand");
-    opt.setCommandFlag("echoexpand");
-    opt.setCommandFlag("errorlist");
-    opt.setCommandFlag("noprompt");
-    opt.setCommandFlag("dummy-passphrase");
-    opt.setCommandFlag("test");
-
-    opt.setCommandOption("args");
-    opt.setCommandOption("myacct");
-    opt.setCommandOption("mynym");
-    opt.setCommandOption("mypurse");
-    opt.setCommandOption("hisacct");
-    opt.setCommandOption("hisnym");
-    opt.setCommandOption("hispurse");
-    opt.setCommandOption("server");
-
-    // for options that will be checked only from the CLI option file
-    opt.setFileOption("defaultserver");
-    opt.setFileOption("defaultmyacct");
-    opt.setFileOption("defaultmynym");
-    opt.setFileOption("defaultmypurse");
-    opt.setFileOption("defaulthisacct");
-    opt.setFileOption("defaulthisnym");
-    opt.setFileOption("defaulthispurse");
-
-    String optionsFile("command-line-ot.opt"), iniFileExact;
-    bool buildFullPathSuccess =
-        OTPaths::RelativeToCanonical(iniFileExact, configPath, optionsFile);
-    OT_ASSERT_MSG(buildFullPathSuccess, "Unable to set Full Path");
+    for (int i = 0; nullptr != GLOBAL_FLAGS[i]; i++) {
+        opt.setCommandFlag(GLOBAL_FLAGS[i]);
+    }
+    for (int i = 0; nullptr != GLOBAL_OPTIONS[i]; i++) {
+        opt.setCommandOption(GLOBAL_OPTIONS[i]);
+    }
+
+    for (int i = 0; nullptr != COMMON_OPTIONS[i]; i++) {
+        opt.setCommandOption(COMMON_OPTIONS[i]);
+    }
 
-    opt.processFile(iniFileExact.Get());
+    // the defaults from the CLI option file are kept in optionsFile_
 }
 
 class DummyPassphraseCallback : public OTCallback
@@ -501,17 +228,21 @@ public:
     }
 };
 
-int Opentxs::processCommand(AnyOption& opt)
+int Opentxs::processCommand(AnyOption& opt, Invocation& call, int32_t index)
 {
     string command = opt.getArgv(0);
 
     if (opt.getFlag("dummy-passphrase")) {
         // For automatic testing, set the password callback to
         // always return "test" as the password, not prompting the user.
-        OTCaller* caller = new OTCaller;
-        DummyPassphraseCallback* callback = new DummyPassphraseCallback("test");
-        caller->setCallback(callback);
-        SwigWrap::SetPasswordCaller(*caller);
+        // The callback is process wide, so it is only installed once.
+        call_once(dummyPassphrase_, []() {
+            OTCaller* caller = new OTCaller;
+            DummyPassphraseCallback* callback =
+                new DummyPassphraseCallback("test");
+            caller->setCallback(callback);
+            SwigWrap::SetPasswordCaller(*caller);
+        });
     }
 
     if ("version" == command) {
@@ -523,9 +254,9 @@ int Opentxs::processCommand(AnyOption& opt)
     if ("list" == command) {
         otOut << "\nCommands:\n\n";
 
-        for (std::size_t i = 0; i < cmds_.size(); ++i) {
-            CmdBase& cmd = *cmds_[i];
-            otOut << (cmd.getCommand() + spaces18).substr(0, 18);
+        for (std::size_t i = 0; i < CmdRegistry::size(); ++i) {
+            const CmdRegistry::Entry& cmd = CmdRegistry::entry(i);
+            otOut << (cmd.command + spaces18).substr(0, 18);
             if (i % 4 == 3) { otOut << "\n"; }
         }
         otOut << "\n";
@@ -541,11 +272,10 @@ int Opentxs::processCommand(AnyOption& opt)
 
         // add commands to their category group
         otOut << "\nCommands:\n";
-        for (std::size_t i = 0; i < cmds_.size(); ++i) {
-            CmdBase& cmd = *cmds_[i];
-            categoryGroup[cmd.getCategory()] +=
-                (cmd.getCommand() + spaces18).substr(0, 18) + cmd.getHelp() +
-                "\n";
+        for (std::size_t i = 0; i < CmdRegistry::size(); ++i) {
+            const CmdRegistry::Entry& cmd = CmdRegistry::entry(i);
+            categoryGroup[cmd.category] +=
+                (cmd.command + spaces18).substr(0, 18) + cmd.help + "\n";
         }
 
         // print all category groups
@@ -554,10 +284,11 @@ int Opentxs::processCommand(AnyOption& opt)
         return 0;
     }
 
-    for (std::size_t i = 0; i < cmds_.size(); ++i) {
-        CmdBase& cmd = *cmds_[i];
-        if (command == cmd.getCommand()) { return runCommand(cmd); }
+    // a compiled script line already knows its command
+    if (0 > index || command != CmdRegistry::entry(index).command) {
+        index = call.cmds->find(command);
     }
+    if (0 <= index) { return runCommand(call.cmds->get(index), call); }
 
     otOut << "Expecting a single opentxs command.\n";
 
@@ -567,345 +298,847 @@ int Opentxs::processCommand(AnyOption& opt)
 int Opentxs::run(int argc, char* argv[])
 {
     OT::App().API().OTAPI().LoadWallet();
-
-    map<string, string> macros;
-    vector<int> errorLineNumbers;
-    vector<string> errorCommands;
-
-    newArgc = argc;
-    newArgv = argv;
+    StartupProfile::mark("load wallet");
 
     AnyOption opt;
     loadOptions(opt);
     opt.processCommandArgs(argc, argv);
+    StartupProfile::mark("parse command line");
+
+    if (StartupProfile::enabled()) {
+        // both are loaded lazily otherwise, and would be billed to the
+        // first command that needs them
+        optionsFile_.table();
+        StartupProfile::mark("options file");
+        OT::App().DB();
+        StartupProfile::mark("storage");
+        StartupProfile::report();
+    }
+
+#ifndef _WIN32
+    // keep this client resident and serve commands from opentxs-client
+    if (opt.getFlag("daemon")) { return serve(opt); }
+#endif
+
+    const char* compile = opt.getValue("compile");
+    if (nullptr != compile) {
+        return compileScript(compile, getOption(opt, "output"), argv[0]);
+    }
 
     // is there a command on the command line?
     if (opt.getArgc() != 0) {
-        expectFailure = false;
-        return processCommand(opt);
+        Invocation call;
+        call.argc = argc;
+        call.argv = argv;
+        call.cmds = &cmds_;
+        call.defaults = optionsFile_.table();
+        return processCommand(opt, call);
     }
 
-    int lineNumber = 0;
-    bool echoCommand = opt.getFlag("echocommand") || opt.getFlag("test");
-    bool echoExpand = opt.getFlag("echoexpand") || opt.getFlag("test");
+    Session session;
+    session.call.cmds = &cmds_;
+    session.echoCommand = opt.getFlag("echocommand") || opt.getFlag("test");
+    session.echoExpand = opt.getFlag("echoexpand") || opt.getFlag("test");
     bool noPrompt = opt.getFlag("noprompt") || opt.getFlag("test");
-    int processed = 0;
-    while (true) {
-        // get next command line from input stream
-        if (!noPrompt) { cout << "\nopentxs> "; }
-        string cmd;
-        getline(cin, cmd);
-
-        // end of file stops processing commands
-        if (cin.eof()) { break; }
-
-        lineNumber++;
-
-        cmd = trim(cmd);
-        if (echoCommand) { cout << cmd << endl; }
-
-        // empty lines and lines starting with a hash character are seen as
-        // comments
-        if (cmd.size() == 0 || cmd[0] == '#') { continue; }
-
-        // exit/quit the command loop?
-        if ("exit" == cmd || "quit" == cmd) { break; }
-
-        string originalCmd = cmd;
-
-        // lines starting with a dollar sign character denote the definition of
-        // a macro of the form: $macroName = macroValue
-        // whitespace around the equal sign is optional
-        // <macroName> can be any combination of A-Z, a-z, 0-9, or _
-        // <macroValue> is anything after the equal sign and whitespace-trimmed
-        // note that <macroValue> can be an empty string
-        // note that the dollar sign itself is part of the immediately following
-        // macro name
-        // note that a macro value stays valid for the entire lifetime of the
-        // command loop
-        // note that macro expansion is done on the command line before
-        // processing the line this means that a macro is allowed to contain
-        // command line escape characters
-        // note that macro expansion is recursive until no expansions are found
-        // any more this means that a macro is allowed to contain other macros
-        if (cmd[0] == '$') {
-            // determine the macro name
-            size_t nameLength = 1;
-            while (nameLength < cmd.length() &&
-                   (isalnum(cmd[nameLength]) || cmd[nameLength] == '_')) {
-                nameLength++;
-            }
-            string macroName = cmd.substr(0, nameLength);
 
-            // skip whitespace
-            size_t i = nameLength;
-            while (i < cmd.length() && isspace(cmd[i])) { i++; }
+    string workers = getOption(opt, "workers");
+    if ("" != workers) {
+        session.workers = max(1, atoi(workers.c_str()));
+    }
 
-            if (i == cmd.length() || cmd[i] != '=') {
-                otOut << "\n\n***ERROR***\n"
-                         "Expected macro definition of the form: "
-                         "$macroName = macroValue\n"
-                         "Command was: "
-                      << cmd;
-                continue;
-            }
+    const char* script = opt.getValue("script");
+    if (nullptr != script) {
+        session.call.commandsOnStdin = isStdin(script);
+        runScript(script, argv[0], session);
+    } else {
+        session.call.commandsOnStdin = true;
+        int32_t lineNumber = 0;
+        string input;
+        ScriptLine line;
+        ScriptCompiler compiler(cmds_, argv[0]);
+        while (true) {
+            // get next command line from input stream
+            if (!noPrompt) { cout << "\nopentxs> "; }
+            getline(cin, input);
+
+            // end of file stops processing commands
+            if (cin.eof()) { break; }
+
+            compiler.compile(++lineNumber, input, line);
+            if (!executeLine(line, session)) { break; }
+        }
+    }
 
-            // remainder of line after trimming whitespace is macro value
-            string macroValue = cmd.substr(i + 1);
-            macros[macroName] = trim(macroValue);
-            continue;
+    // a block that was never closed still runs
+    if (session.inBlock) {
+        otOut << "\n\n***ERROR***\nMissing } after parallel block.\n";
+        runParallel(session);
+    }
+
+    if (!session.jobs.empty()) {
+        cout << "\nWaiting for " << session.jobs.size()
+             << " background jobs to finish.\n";
+        // cancelled jobs too, they still use this client
+        for (auto& job : session.jobs) { job->thread.join(); }
+        finishJobs(session, 0, false);
+    }
+
+    int failed = session.errorLineNumbers.size();
+    cout << "\n\n"
+         << session.processed << " commands were processed.\n"
+         << failed << " commands failed.\n"
+         << endl;
+
+    if (opt.getFlag("errorList") || opt.getFlag("test")) {
+        for (size_t i = 0; i < session.errorLineNumbers.size(); i++) {
+            cout << "\nFailed line " << session.errorLineNumbers[i] << ": "
+                 << session.errorCommands[i] << endl;
         }
+    }
 
-        // now replace any macro in the command line with its value
-        // unknown macro names will cause an error message instead of command
-        // execution
-        // note that all macro names are 'maximum munch'
-        int expansions = 0;
-        for (size_t macro = cmd.find_first_of("$"); macro != string::npos;
-             macro = cmd.find_first_of("$", macro + 1)) {
-            // first see if this is an escaped literal
-            if (macro > 0 && cmd[macro - 1] == '\\') { continue; }
-
-            // gather rest of macro name 'maximum munch'
-            size_t macroEnd = macro + 1;
-            while (macroEnd < cmd.length() &&
-                   (isalnum(cmd[macroEnd]) || cmd[macroEnd] == '_')) {
-                macroEnd++;
-            }
+    return failed == 0 ? 0 : -1;
+}
 
-            // has this macro been defined?
-            string macroName = cmd.substr(macro, macroEnd - macro);
-            auto found = macros.find(macroName);
-            if (found == macros.end()) {
-                otOut << "\n\n***ERROR***\n"
-                         "Macro expansion failed.\n"
-                         "Unknown macro: "
-                      << macroName
-                      << "\n"
-                         "Command was: "
-                      << cmd;
-                expansions = 100;
-                break;
-            }
+int Opentxs::exec(int argc, char* argv[])
+{
+    AnyOption opt;
+    loadOptions(opt);
+    opt.processCommandArgs(argc, argv);
 
-            string& macroValue = found->second;
+    if (0 == opt.getArgc()) {
+        otOut << "Expecting a single opentxs command.\n";
+        return -1;
+    }
 
-            // limit to 100 expansions to avoid endless recusion loop
-            expansions++;
-            if (expansions > 100) {
-                otOut << "\n\n***ERROR***\n"
-                         "Macro expansion failed.\n"
-                         "Too many expansions at macro: "
-                      << macroName
-                      << "\n"
-                         "Command was: "
-                      << cmd;
-                break;
-            }
+    Invocation call;
+    call.argc = argc;
+    call.argv = argv;
+    call.cmds = &cmds_;
+    call.defaults = optionsFile_.table();
+    return processCommand(opt, call);
+}
 
-            // limit to 10000 characters to avoid crazy recursive expansions
-            if (cmd.length() + macroValue.length() > 10000) {
+bool Opentxs::executeLine(const ScriptLine& line, Session& session)
+{
+    // report background jobs that finished in the meantime
+    if (!session.jobs.empty()) { finishJobs(session, 0, false); }
+
+    if (session.inBlock) {
+        switch (line.kind) {
+            case ScriptLine::End:
+                if (session.echoCommand) { cout << line.text << endl; }
+                runParallel(session);
+                return true;
+
+            case ScriptLine::Exit:
+                runParallel(session);
+                if (session.echoCommand) { cout << line.text << endl; }
+                return false;
+
+            case ScriptLine::Parallel:
+                if (session.echoCommand) { cout << line.text << endl; }
                 otOut << "\n\n***ERROR***\n"
-                         "Macro expansion failed.\n"
-                         "Command length exceeded at macro: "
-                      << macroName
-                      << "\n"
-                         "Macro value is: "
-                      << macroValue
-                      << "\n"
-                         "Command was: "
-                      << cmd;
-                expansions = 100;
-                break;
-            }
+                         "Parallel blocks cannot be nested.\n";
+                return true;
 
-            // expand the command line
-            cmd = cmd.substr(0, macro) + macroValue + cmd.substr(macroEnd);
+            default:
+                // echoed and run together with the rest of the block
+                session.block.push_back(line);
+                return true;
         }
+    }
 
-        if (echoExpand && cmd != originalCmd) { otOut << cmd << endl; }
-
-        // skip command when anything during macro expansion failed
-        if (expansions > 99) { continue; }
-
-        // '!' indicates that we expect this command to fail
-        //     which is very useful for running a test script
-        expectFailure = cmd[0] == '!';
-
-        // Parse command string into its separate parts so it can be passed as
-        // an argc/argv combo
-        // Whitespace separates args as usual.
-        // To include whitespace in an arg surround the entire arg with double
-        // quotes
-        // An unterminated double-quoted arg will auto-terminate at end of line
-        // All characters are taken literal except for: double quote, dollar
-        // sign, and backslash
-        // To take any character literal, precede it with a backslash
-        vector<string> arguments;
-
-        // add original command name
-        arguments.push_back(argv[0]);
-
-        // set up buffer that will receive the separate arguments
-        char* buf = new char[cmd.length() + 1];
-        char* arg = buf;
-
-        // start at actual command
-        size_t i = expectFailure ? 1 : 0;
-        while (i < cmd.length()) {
-            // skip any whitespace
-            while (i < cmd.length() && isspace(cmd[i])) { i++; }
-            if (i == cmd.length()) {
-                // it was trailing whitespace; we're done
-                break;
-            }
+    if (session.echoCommand) { cout << line.text << endl; }
+
+    switch (line.kind) {
+        case ScriptLine::Exit:
+            return false;
+
+        case ScriptLine::Parallel:
+            session.inBlock = true;
+            return true;
+
+        case ScriptLine::End:
+            otOut << "\n\n***ERROR***\n"
+                     "Unexpected } outside parallel block.\n";
+            return true;
+
+        case ScriptLine::Command:
+            break;
+
+        default:
+            return true;
+    }
+
+    if (session.echoExpand && line.expanded != line.text) {
+        otOut << line.expanded << endl;
+    }
+
+    if (jobCommand(line, session)) { return true; }
+
+    if (line.background) {
+        startJob(line, session);
+        return true;
+    }
+
+    session.call.defaults = optionsFile_.table();
+
+    cout << "\n";
+    if (!runLine(line, session.call)) { reportFailure(line, session); }
+
+    otOut << "\n\n";
+    session.processed++;
+
+    return true;
+}
+
+bool Opentxs::runLine(const ScriptLine& line, Invocation& call)
+{
+    // set up a new argc/argv combo pointing into the line's arguments;
+    // AnyOption only ever reads them
+    call.args.clear();
+    const char* arg = line.args.data();
+    for (int32_t i = 0; i < line.argc; i++) {
+        call.args.push_back(const_cast<char*>(arg));
+        arg += strlen(arg) + 1;
+    }
+
+    call.argc = call.args.size();
+    call.argv = call.args.data();
+    call.expectFailure = line.expectFailure;
+
+    // preprocess the command line
+    AnyOption opt;
+    loadOptions(opt);
+    opt.processCommandArgs(call.argc, call.argv);
+
+    int status = processCommand(opt, call, line.command);
+
+    call.argc = 0;
+    call.argv = nullptr;
 
-            // remember where we start this new argument in the buffer
-            char* start = arg;
-
-            // unquoted argument?
-            if (cmd[i] != '"') {
-                // take everything until end of line or next whitespace
-                while (i < cmd.length() && !isspace(cmd[i])) {
-                    // unescaped literal character?
-                    if (cmd[i] != '\\') {
-                        // yep, add to buffer and go for next
-                        *arg++ = cmd[i++];
-                        continue;
-                    }
-
-                    // take next character literal unless it was the end of line
-                    // in which case we simply add the backslash as a literal
-                    // character
-                    *arg++ = i < cmd.length() ? cmd[i++] : '\\';
-                }
-
-                // end of argument reached, terminate an add to arguments array
-                *arg++ = '\0';
-                arguments.push_back(start);
-
-                // look for next argument
-                continue;
+    return call.expectFailure == (0 != status);
+}
+
+void Opentxs::reportFailure(const ScriptLine& line, Session& session)
+{
+    session.errorLineNumbers.push_back(line.lineNumber);
+    session.errorCommands.push_back(line.text);
+    otOut << "\n\n***ERROR***\n"
+          << (line.expectFailure ? "Expected command to fail.\nSucceeding"
+                                 : "Failed")
+          << " command was: " << line.expanded;
+}
+
+string Opentxs::notaryKey(
+    const ScriptLine& line,
+    const OptionsFile::Table& defaults)
+{
+    static const char* names[] = {"--server", "--mynym", "--myacct"};
+    string values[3];
+    string& server = values[0];
+    string& mynym = values[1];
+    string& myacct = values[2];
+
+    // pick the options out of the packed arguments, in either the
+    // "--name value" or the "--name=value" form
+    const char* arg = line.args.data();
+    const char* end = arg + line.args.length();
+    while (arg < end) {
+        size_t length = strlen(arg);
+        const char* next = arg + length + 1;
+        for (int i = 0; i < 3; i++) {
+            size_t nameLength = strlen(names[i]);
+            if (0 != strncmp(arg, names[i], nameLength)) { continue; }
+            if ('=' == arg[nameLength]) {
+                values[i] = arg + nameLength + 1;
+            } else if (nameLength == length && next < end) {
+                values[i] = next;
             }
+        }
+        arg = next;
+    }
+
+    // an account implies its owner and notary
+    if ("" != myacct) {
+        CmdBase::ClientLock lock;
+        if ("" == mynym) { mynym = SwigWrap::GetAccountWallet_NymID(myacct); }
+        if ("" == server) {
+            server = SwigWrap::GetAccountWallet_NotaryID(myacct);
+        }
+    }
+
+    auto found = defaults.find("defaultserver");
+    if ("" == server && found != defaults.end()) { server = found->second; }
+    found = defaults.find("defaultmynym");
+    if ("" == mynym && found != defaults.end()) { mynym = found->second; }
+
+    return server + "/" + mynym;
+}
 
-            // double quoted argument, skip the quote
-            i++;
-
-            // take everything until end of line or next double quote
-            while (i < cmd.length() && cmd[i] != '"') {
-                // unescaped literal character?
-                if (cmd[i] != '\\') {
-                    // yep, add to buffer and go for next
-                    *arg++ = cmd[i++];
-                    continue;
-                }
-
-                // take next character literal unless it was the end of line
-                // in which case we simply add the backslash as a literal
-                // character
-                *arg++ = i < cmd.length() ? cmd[i++] : '\\';
+void Opentxs::runParallel(Session& session)
+{
+    session.inBlock = false;
+    vector<ScriptLine> block;
+    block.swap(session.block);
+
+    auto defaults = optionsFile_.table();
+
+    // a nym's requests to the same notary are numbered, so they have to
+    // stay in script order; everything else may run concurrently
+    map<string, vector<size_t>> queues;
+    for (size_t i = 0; i < block.size(); i++) {
+        if (ScriptLine::Command == block[i].kind) {
+            queues[notaryKey(block[i], *defaults)].push_back(i);
+        }
+    }
+
+    vector<vector<size_t>> work;
+    for (auto& queue : queues) { work.push_back(move(queue.second)); }
+
+    vector<string> output(block.size());
+    vector<string> log(block.size());
+    vector<char> passed(block.size(), 1);
+    atomic<size_t> next(0);
+
+    auto worker = [&]() {
+        // the lines run out of order, none of them may take the next
+        // line of the script or the user's next command as its input
+        CmdBase::NoInput noInput;
+        // command objects keep the options of the line they are running
+        CmdRegistry cmds;
+        Invocation call;
+        call.cmds = &cmds;
+        call.defaults = defaults;
+
+        for (size_t queue = next++; queue < work.size(); queue = next++) {
+            for (size_t i : work[queue]) {
+                OutputCapture capture(output[i], &log[i]);
+                passed[i] = runLine(block[i], call);
             }
+        }
+    };
+
+    size_t count = min<size_t>(session.workers, work.size());
+    vector<thread> threads;
+    for (size_t i = 1; i < count; i++) { threads.emplace_back(worker); }
+    if (0 < count) { worker(); }
+    for (auto& thread : threads) { thread.join(); }
+
+    // report everything in script order, as if it had run sequentially
+    for (size_t i = 0; i < block.size(); i++) {
+        const ScriptLine& line = block[i];
+        if (session.echoCommand) { cout << line.text << endl; }
+        if (ScriptLine::Command != line.kind) { continue; }
+
+        if (session.echoExpand && line.expanded != line.text) {
+            otOut << line.expanded << endl;
+        }
 
-            // end of argument reached, terminate an add to arguments array
-            *arg++ = '\0';
-            arguments.push_back(start);
+        cout << "\n" << output[i];
+        otOut << log[i];
+        if (!passed[i]) { reportFailure(line, session); }
 
-            // skip terminating double quote or end of line
-            i++;
+        otOut << "\n\n";
+        session.processed++;
+    }
+}
+
+void Opentxs::startJob(const ScriptLine& line, Session& session)
+{
+    session.jobs.emplace_back(new Job);
+    Job* job = session.jobs.back().get();
+    job->id = session.nextJob++;
+    job->line = line;
+    job->started = chrono::steady_clock::now();
+
+    auto defaults = optionsFile_.table();
+    job->thread = thread([this, job, defaults]() {
+        // stdin belongs to the interactive loop, see CmdBase::NoInput
+        CmdBase::NoInput noInput;
+        // command objects keep the options of the line they are running
+        CmdRegistry cmds;
+        Invocation call;
+        call.cmds = &cmds;
+        call.defaults = defaults;
+        {
+            OutputCapture capture(job->output, &job->log);
+            job->passed = runLine(job->line, call);
         }
+        job->done = true;
+    });
+
+    cout << "[%" << job->id << "] " << line.expanded << "\n";
+}
+
+bool Opentxs::jobCommand(const ScriptLine& line, Session& session)
+{
+    vector<string> args;
+    const char* arg = line.args.data();
+    for (int32_t i = 0; i < line.argc; i++) {
+        args.emplace_back(arg);
+        arg += args.back().length() + 1;
+    }
 
-        // set up a new argc/argv combo
-        newArgc = arguments.size();
-        newArgv = new char*[newArgc];
-        for (int i = 0; i < newArgc; i++) {
-            newArgv[i] = const_cast<char*>(arguments[i].c_str());
+    if (2 > args.size()) { return false; }
+    const string& command = args[1];
+
+    if ("jobs" == command && 2 == args.size()) {
+        auto now = chrono::steady_clock::now();
+        for (const auto& job : session.jobs) {
+            auto elapsed = chrono::duration_cast<chrono::seconds>(
+                now - job->started);
+            cout << "[%" << job->id << "] "
+                 << (job->done ? "Done     "
+                               : job->cancelled ? "Cancelled" : "Running  ")
+                 << " " << elapsed.count() << "s  " << job->line.expanded
+                 << "\n";
         }
+        return true;
+    }
 
-        // preprocess the command line
-        AnyOption opt;
-        loadOptions(opt);
-        opt.processCommandArgs(newArgc, newArgv);
+    if ("wait" == command && 2 == args.size()) {
+        finishJobs(session, 0, true);
+        return true;
+    }
 
-        cout << "\n";
-        if (expectFailure != (0 != processCommand(opt))) {
-            errorLineNumbers.push_back(lineNumber);
-            errorCommands.push_back(originalCmd);
-            otOut << "\n\n***ERROR***\n"
-                  << (expectFailure ? "Expected command to fail.\nSucceeding"
-                                    : "Failed")
-                  << " command was: " << cmd;
+    // jobs are always written as %id, so "cancel" without one is still
+    // the cancel command for outgoing cash
+    bool isJob = ("wait" == command || "cancel" == command) &&
+                 3 == args.size() && '%' == args[2][0];
+    if (!isJob) {
+        if ("wait" != command) { return false; }
+        otOut << "Error: expected wait [%id]\n";
+        return true;
+    }
+
+    int id = atoi(args[2].c_str() + 1);
+
+    Job* found = nullptr;
+    for (const auto& job : session.jobs) {
+        if (id == job->id) { found = job.get(); }
+    }
+    if (nullptr == found) {
+        otOut << "Error: no such job: %" << id << "\n";
+        return true;
+    }
+
+    if ("cancel" == command) {
+        // a request that is already on its way to the notary cannot be
+        // called back, so the job runs to completion unseen
+        found->cancelled = true;
+        cout << "[%" << id << "] Cancelled; its result will be discarded.\n";
+        return true;
+    }
+
+    finishJobs(session, id, true);
+    return true;
+}
+
+void Opentxs::finishJobs(Session& session, int id, bool wait)
+{
+    for (auto it = session.jobs.begin(); it != session.jobs.end();) {
+        Job& job = **it;
+        if ((0 != id && id != job.id) ||
+            (!job.done && (!wait || (0 == id && job.cancelled)))) {
+            ++it;
+            continue;
         }
 
-        delete[] newArgv;
-        delete[] buf;
+        if (job.thread.joinable()) { job.thread.join(); }
 
-        newArgc = 0;
-        newArgv = nullptr;
+        if (!job.cancelled) {
+            cout << "\n[%" << job.id << "] Done: " << job.line.expanded
+                 << "\n"
+                 << job.output;
+            otOut << job.log;
+            if (!job.passed) { reportFailure(job.line, session); }
+            otOut << "\n\n";
+            session.processed++;
+        }
 
-        otOut << "\n\n";
-        processed++;
+        it = session.jobs.erase(it);
     }
+}
 
-    int failed = errorLineNumbers.size();
-    cout << "\n\n"
-         << processed << " commands were processed.\n"
-         << failed << " commands failed.\n"
-         << endl;
+bool Opentxs::readScript(const string& path, string& data)
+{
+    ifstream file(path.c_str(), ios::in | ios::binary);
+    if (!file) {
+        otOut << "Error: cannot read script: " << path << "\n";
+        return false;
+    }
 
-    if (opt.getFlag("errorList") || opt.getFlag("test")) {
-        for (size_t i = 0; i < errorLineNumbers.size(); i++) {
-            cout << "\nFailed line " << errorLineNumbers[i] << ": "
-                 << errorCommands[i] << endl;
+    ostringstream contents;
+    contents << file.rdbuf();
+    data = contents.str();
+    return true;
+}
+
+string Opentxs::scriptCacheFolder()
+{
+    String configPath(OTPaths::AppDataFolder()), folderPath;
+    bool buildFullPathSuccess = OTPaths::RelativeToCanonical(
+        folderPath, configPath, String("script-cache"));
+    OT_ASSERT_MSG(buildFullPathSuccess, "Unable to set Full Path");
+
+    string folder = folderPath.Get();
+#ifdef _WIN32
+    _mkdir(folder.c_str());
+#else
+    mkdir(folder.c_str(), 0700);
+#endif
+    return folder;
+}
+
+string Opentxs::scriptCachePath(uint64_t hash)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "/%016llx.bin", (unsigned long long)hash);
+    return scriptCacheFolder() + name;
+}
+
+// Entries are keyed by the script text, so every edit of a script leaves
+// its previous entry behind, and an upgrade invalidates all of them. Drop
+// the ones this build can no longer load whenever a new one is written.
+void Opentxs::pruneScriptCache()
+{
+    error_code error;
+    filesystem::directory_iterator it(scriptCacheFolder(), error);
+    for (; !error && filesystem::directory_iterator() != it;
+         it.increment(error)) {
+        const auto& path = it->path();
+        if (".bin" != path.extension()) { continue; }
+
+        // the header is all isCurrent() needs
+        char header[512];
+        ifstream cache(path, ios::in | ios::binary);
+        cache.read(header, sizeof(header));
+        const string data(header, cache.gcount());
+        cache.close();
+
+        if (!CompiledScript::isCurrent(data)) {
+            error_code ignored;
+            filesystem::remove(path, ignored);
         }
     }
+}
+
+int Opentxs::compileScript(
+    const string& path,
+    const string& output,
+    const char* argv0)
+{
+    string source;
+    if (!readScript(path, source)) { return -1; }
+
+    istringstream in(source);
+    string input;
+    int32_t lineNumber = 0;
+    bool valid = true;
+    ScriptLine line;
+    ScriptCompiler compiler(cmds_, argv0);
+    CompiledScript compiled;
+    while (getline(in, input)) {
+        compiler.compile(++lineNumber, input, line);
+        valid = valid && ScriptLine::Invalid != line.kind;
+        compiled.add(line);
+        if (ScriptLine::Exit == line.kind) { break; }
+    }
 
-    return failed == 0 ? 0 : -1;
+    if (!valid) {
+        otOut << "\nError: cannot compile " << path << "\n";
+        return -1;
+    }
+
+    string target = "" != output ? output : path + ".bin";
+    if (!compiled.save(target, CompiledScript::hash(source))) {
+        otOut << "Error: cannot write compiled script: " << target << "\n";
+        return -1;
+    }
+
+    otOut << "Compiled " << lineNumber << " lines into " << target << "\n";
+    return 0;
 }
 
-int Opentxs::runCommand(CmdBase& cmd)
+void Opentxs::runScript(
+    const string& path,
+    const char* argv0,
+    Session& session)
 {
-    auto argNames = cmd.extractArgumentNames();
+    string data;
+    if (!readScript(path, data)) {
+        session.errorLineNumbers.push_back(0);
+        session.errorCommands.push_back(path);
+        return;
+    }
+
+    CompiledScript compiled;
+
+    // a script compiled with --compile
+    if (CompiledScript::isCompiled(data)) {
+        if (!compiled.load(data, 0)) {
+            otOut << "Error: " << path
+                  << " was compiled by a different opentxs build. "
+                     "Please compile it again.\n";
+            session.errorLineNumbers.push_back(0);
+            session.errorCommands.push_back(path);
+            return;
+        }
+    } else {
+        // otherwise use the cached compilation of this exact script text
+        uint64_t hash = CompiledScript::hash(data);
+        string cachePath = scriptCachePath(hash);
+        string cached;
+        ifstream cache(cachePath.c_str(), ios::in | ios::binary);
+        if (cache) {
+            ostringstream contents;
+            contents << cache.rdbuf();
+            cached = contents.str();
+        }
+
+        if (!compiled.load(cached, hash)) {
+            // run the script and compile it along the way; it is only
+            // cached when every line could be compiled
+            istringstream in(data);
+            string input;
+            int32_t lineNumber = 0;
+            bool valid = true;
+            ScriptLine line;
+            ScriptCompiler compiler(cmds_, argv0);
+            compiled.clear();
+            while (getline(in, input)) {
+                compiler.compile(++lineNumber, input, line);
+                valid = valid && ScriptLine::Invalid != line.kind;
+                compiled.add(line);
+                if (!executeLine(line, session)) { break; }
+            }
 
-    AnyOption options;
-    for (size_t i = 0; i < argNames.size(); i++) {
-        if (!options.findOption(argNames[i].c_str())) {
-            options.setCommandOption(argNames[i].c_str());
+            if (!valid) { return; }
+            if (compiled.save(cachePath, hash)) {
+                pruneScriptCache();
+            } else {
+                otWarn << "Cannot write script cache: " << cachePath << "\n";
+            }
+            return;
         }
     }
 
-    loadOptions(options);
-    options.processCommandArgs(newArgc, newArgv);
+    for (const auto& line : compiled.lines()) {
+        if (!executeLine(line, session)) { break; }
+    }
+}
 
-    map<string, string> arguments;
-    for (size_t i = 0; i < argNames.size(); i++) {
-        const char* optionName = argNames[i].c_str();
-        const char* value = options.getValue(optionName);
-        if (value != nullptr) {
-            arguments[argNames[i]] = value;
-            continue;
+int Opentxs::runCommand(CmdBase& cmd, const Invocation& call)
+{
+    // a single pass over the command line, straight into the argument
+    // slots of the command; the values keep pointing into argv. Only the
+    // command's own arguments and the main options are known, so that a
+    // mistyped option is reported instead of swallowing the next token.
+    CmdBase::Values values{};
+    const char* format = nullptr;
+    const char* input = nullptr;
+    for (int i = 1; i < call.argc; i++) {
+        const char* token = call.argv[i];
+        if ('-' != token[0] || '-' != token[1]) { continue; }
+
+        string_view name(token + 2);
+        const char* value = nullptr;
+        auto equals = name.find('=');
+        if (string_view::npos != equals) {
+            value = token + 2 + equals + 1;
+            name = name.substr(0, equals);
+        }
+        const int32_t index = cmd.findArgument(name);
+        if (0 > index && !isFlag(name) && !isOption(name)) {
+            otOut << "Error: unknown option --" << name << " for "
+                  << cmd.getCommand() << ".\n";
+            return -1;
         }
 
-        static const string defaultPrefix = "default";
-        static const string haveDefault[] = {"hisacct",
-                                             "hisnym",
-                                             "hispurse",
-                                             "myacct",
-                                             "mynym",
-                                             "mypurse",
-                                             "server",
-                                             ""};
-
-        // can we get the argument value from the option file?
-        for (int i = 0; haveDefault[i] != ""; i++) {
-            if (haveDefault[i] == optionName) {
-                value = options.getValue((defaultPrefix + optionName).c_str());
-                if (value != nullptr) { arguments[argNames[i]] = value; }
-                break;
+        if (nullptr == value) {
+            if (0 > index) {
+                // the main flags are read by AnyOption
+                if (isFlag(name)) { continue; }
+            } else if (cmd.getArgument(index).flag) {
+                value = "true";
             }
         }
+        if (nullptr == value) {
+            if (i + 1 >= call.argc) { continue; }
+            value = call.argv[++i];
+        }
+
+        if ("format" == name) {
+            format = value;
+            continue;
+        }
+        if ("input-file" == name || "input" == name) {
+            input = value;
+            continue;
+        }
+
+        if (0 <= index) { values[index] = value; }
+    }
+
+    // can we get the missing argument values from the option file?
+    for (size_t i = 0; i < cmd.getArgumentCount(); i++) {
+        const Argument& arg = cmd.getArgument(i);
+        if (nullptr != values[i] || nullptr == arg.defaultKey) { continue; }
+        auto found = call.defaults->find(arg.defaultKey);
+        if (found != call.defaults->end()) {
+            values[i] = found->second.c_str();
+        }
     }
 
-    bool success = cmd.run(arguments);
-    if (!success && !expectFailure) { cout << cmd.getUsage(); }
+    if (nullptr != input && 0 == strcmp(input, "-") && call.commandsOnStdin) {
+        otOut << "Error: --input - cannot be used while commands are read "
+                 "from stdin. Use --input-file <file>.\n";
+        return -1;
+    }
+
+    // listings act on the output format, the other commands refuse ndjson
+    auto found = call.defaults->find("defaultformat");
+    format = cmd.outputFormat(
+        format,
+        found != call.defaults->end() ? found->second.c_str() : nullptr);
+    if (nullptr == format) { return -1; }
+
+    // commands take turns at the client, except while they wait on a notary
+    CmdBase::ClientLock lock;
+
+    bool success = false;
+    {
+        CommandStats::Command timing(cmd.getCommand());
+        Trace::Span span(cmd.getCommand(), "command");
+        success = cmd.run(values, format, input);
+    }
+    if (!success && !call.expectFailure) { cout << cmd.getUsage(); }
+    // even a failed command may have changed part of the wallet
+    if (CmdRegistry::changesWallet(cmd.getCommand())) {
+        Resolver::invalidate();
+        UnitCache::invalidate();
+    }
+    if (success) { CompletionIndex::refreshIds(cmd.getCommand()); }
     return success ? 0 : -1;
 }
+
+#ifndef _WIN32
+int Opentxs::serve(AnyOption& opt)
+{
+    string socketPath = getOption(opt, "socket");
+    if ("" == socketPath) { socketPath = Ipc::defaultSocket(); }
+    if ("" == socketPath) {
+        otOut << "Error: cannot determine the socket path. "
+                 "Use --socket <path> or set OPENTXS_CLI_SOCKET.\n";
+        return -1;
+    }
+
+    int listener = Ipc::listenOn(socketPath);
+    if (0 > listener) {
+        otOut << "Error: cannot listen on " << socketPath << ": "
+              << strerror(errno) << "\n";
+        return -1;
+    }
+
+    // no SA_RESTART, so that a blocking accept() notices the signal
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = handleStopSignal;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    // a client that goes away must not take the daemon down with it
+    signal(SIGPIPE, SIG_IGN);
+
+    otOut << "Serving opentxs commands on " << socketPath << "\n";
+
+    while (!stopDaemon) {
+        int client = accept(listener, nullptr, nullptr);
+        if (0 > client) {
+            if (EINTR == errno) { continue; }
+            otOut << "Error: cannot accept connection: " << strerror(errno)
+                  << "\n";
+            break;
+        }
+
+        timeval timeout{Ipc::REQUEST_TIMEOUT, 0};
+        if (0 != setsockopt(
+                     client,
+                     SOL_SOCKET,
+                     SO_RCVTIMEO,
+                     &timeout,
+                     sizeof(timeout))) {
+            otOut << "Error: cannot set the request timeout: "
+                  << strerror(errno) << "\n";
+            close(client);
+            continue;
+        }
+
+        serveClient(client);
+        close(client);
+    }
+
+    close(listener);
+    unlink(socketPath.c_str());
+    otOut << "Daemon stopped.\n";
+
+    return 0;
+}
+
+void Opentxs::serveClient(int client)
+{
+    static const int streams[Ipc::STREAMS] = {
+        STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO};
+
+    vector<string> args;
+    int fds[Ipc::STREAMS];
+    errno = 0;
+    if (!Ipc::receiveRequest(client, args, fds)) {
+        const bool timedOut = EAGAIN == errno || EWOULDBLOCK == errno;
+        for (int i = 0; i < Ipc::STREAMS; i++) {
+            if (0 <= fds[i]) { close(fds[i]); }
+        }
+        if (timedOut) {
+            otOut << "Error: timed out waiting for a daemon request.\n";
+        } else {
+            otOut << "Error: received a malformed daemon request.\n";
+        }
+        return;
+    }
+
+    vector<char*> arguments;
+    for (auto& arg : args) { arguments.push_back(&arg[0]); }
+
+    // run the command with the client's own stdin/stdout/stderr so that
+    // its output streams straight to the caller
+    cout.flush();
+    cerr.flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    int saved[Ipc::STREAMS];
+    for (int i = 0; i < Ipc::STREAMS; i++) {
+        saved[i] = dup(streams[i]);
+        dup2(fds[i], streams[i]);
+        close(fds[i]);
+    }
+    cin.clear();
+    clearerr(stdin);
+
+    int status = exec(arguments.size(), arguments.data());
+
+    cout.flush();
+    cerr.flush();
+    fflush(stdout);
+    fflush(stderr);
+
+    for (int i = 0; i < Ipc::STREAMS; i++) {
+        dup2(saved[i], streams[i]);
+        close(saved[i]);
+    }
+
+    Ipc::sendStatus(client, status);
+}
+#endif
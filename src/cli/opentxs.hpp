@@ -39,7 +39,18 @@
 #ifndef __OPENTXS_HPP__
 #define __OPENTXS_HPP__
 
+#include "CmdRegistry.hpp"
+#include "OptionsFile.hpp"
+#include "ScriptCompiler.hpp"
+
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 class AnyOption;
@@ -56,26 +67,97 @@ public:
     virtual ~Opentxs();
 
     int run(int argc, char* argv[]);
+    // Runs a single command with the wallet that is already loaded, the
+    // way the daemon and libopentxs-cli do.
+    int exec(int argc, char* argv[]);
 
 private:
+    // A single command line being run. Lines of a parallel block each get
+    // their own, so nothing in here is shared between threads.
+    struct Invocation {
+        int argc{0};
+        char** argv{nullptr};
+        bool expectFailure{false};
+        // the commands themselves are read from stdin, so "--input -"
+        // would swallow the rest of them
+        bool commandsOnStdin{false};
+        CmdRegistry* cmds{nullptr};
+        std::shared_ptr<const OptionsFile::Table> defaults;
+        // argv storage when running a ScriptLine
+        std::vector<char*> args;
+    };
+
+    // A command started in the background with a trailing &.
+    struct Job {
+        int id{0};
+        ScriptLine line;
+        std::chrono::steady_clock::time_point started;
+        std::thread thread;
+        std::atomic<bool> done{false};
+        bool cancelled{false};
+        bool passed{false};
+        std::string output;
+        std::string log;
+    };
+
+    struct Session {
+        bool echoCommand{false};
+        bool echoExpand{false};
+        int processed{0};
+        std::vector<int> errorLineNumbers;
+        std::vector<std::string> errorCommands;
+        Invocation call;
+        // lines of the parallel block being collected
+        bool inBlock{false};
+        std::vector<ScriptLine> block;
+        int workers{4};
+        int nextJob{1};
+        std::list<std::unique_ptr<Job>> jobs;
+    };
+
     void loadOptions(AnyOption& opt);
     const char* getOption(
         AnyOption& opt,
         const char* optionName,
         const char* defaultName = nullptr);
-    int processCommand(AnyOption& opt);
-    int runCommand(CmdBase& cmd);
+    int processCommand(
+        AnyOption& opt,
+        Invocation& call,
+        int32_t index = -1);
+    int runCommand(CmdBase& cmd, const Invocation& call);
 
-    std::string& ltrim(std::string& s);
-    std::string& rtrim(std::string& s);
-    std::string& trim(std::string& s);
+    bool executeLine(const ScriptLine& line, Session& session);
+    bool runLine(const ScriptLine& line, Invocation& call);
+    void reportFailure(const ScriptLine& line, Session& session);
+    std::string notaryKey(
+        const ScriptLine& line,
+        const OptionsFile::Table& defaults);
+    void runParallel(Session& session);
+    void startJob(const ScriptLine& line, Session& session);
+    bool jobCommand(const ScriptLine& line, Session& session);
+    void finishJobs(Session& session, int id, bool wait);
+    bool readScript(const std::string& path, std::string& data);
+    std::string scriptCacheFolder();
+    std::string scriptCachePath(uint64_t hash);
+    void pruneScriptCache();
+    int compileScript(
+        const std::string& path,
+        const std::string& output,
+        const char* argv0);
+    void runScript(
+        const std::string& path,
+        const char* argv0,
+        Session& session);
+#ifndef _WIN32
+    int serve(AnyOption& opt);
+    void serveClient(int client);
+#endif
 
     const std::string spaces18 = "                  ";
 
-    int newArgc{0};
-    char** newArgv{nullptr};
-    bool expectFailure{false};
-    std::vector<CmdBase*> cmds_;
+    std::once_flag dummyPassphrase_;
+    CmdRegistry cmds_;
+    OptionsFile optionsFile_;
 };
 }  // namespace opentxs
 #endif  // __OPENTXS_HPP__
@@ -0,0 +1,136 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "otcli.h"
+
+#include "OutputCapture.hpp"
+#include "commands/CmdBase.hpp"
+#include "opentxs.hpp"
+
+#include <opentxs/opentxs.hpp>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+struct otcli {
+    // commands share the client's wallet, so they run one at a time
+    mutex lock;
+    Opentxs cli;
+};
+
+namespace
+{
+mutex openLock;
+bool isOpen = false;
+}  // namespace
+
+// nothing may throw across the C interface, a failure is just a NULL handle
+// or a -1 status
+
+otcli* otcli_open(void)
+{
+    lock_guard<mutex> lock(openLock);
+    if (isOpen) { return nullptr; }
+
+    try {
+        OT::ClientFactory({});
+        OT::App().API().OTAPI().LoadWallet();
+        otcli* handle = new otcli;
+        isOpen = true;
+        return handle;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int otcli_exec(
+    otcli* handle,
+    int argc,
+    const char* const* argv,
+    otcli_output output,
+    void* context)
+{
+    if (nullptr == handle || 0 > argc || (0 < argc && nullptr == argv)) {
+        return -1;
+    }
+
+    // the command line parser expects a program name and writable strings
+    vector<string> args;
+    args.push_back("opentxs");
+    for (int i = 0; i < argc; i++) {
+        if (nullptr == argv[i]) { return -1; }
+        args.push_back(argv[i]);
+    }
+
+    vector<char*> arguments;
+    for (auto& arg : args) { arguments.push_back(&arg[0]); }
+    arguments.push_back(nullptr);
+
+    string captured;
+    int status = -1;
+    {
+        lock_guard<mutex> lock(handle->lock);
+        OutputCapture capture(captured);
+        try {
+            status = handle->cli.exec(args.size(), arguments.data());
+        } catch (...) {
+            status = -1;
+        }
+        CmdBase::flushOutput();
+    }
+
+    if (nullptr != output && !captured.empty()) {
+        output(captured.data(), captured.length(), context);
+    }
+
+    return status;
+}
+
+void otcli_close(otcli* handle)
+{
+    if (nullptr == handle) { return; }
+
+    lock_guard<mutex> lock(openLock);
+    delete handle;
+    OT::Cleanup();
+    isOpen = false;
+}
@@ -0,0 +1,97 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_OTCLI_H__
+#define __OPENTXS_OTCLI_H__
+
+#include <stddef.h>
+
+#ifndef OTCLI_API
+#ifdef _WIN32
+#define OTCLI_API __declspec(dllimport)
+#else
+#define OTCLI_API
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * C interface of libopentxs-cli, for running opentxs commands in-process.
+ *
+ * otcli_open() starts the client and loads the wallet, which is what makes
+ * every "opentxs <command>" process slow to start. The handle then runs any
+ * number of commands against that client:
+ *
+ *     otcli* cli = otcli_open();
+ *     const char* argv[] = {"showaccounts", "--format=ndjson"};
+ *     int status = otcli_exec(cli, 2, argv, print, NULL);
+ *     otcli_close(cli);
+ *
+ * There is one client per process, so a second otcli_open() fails until the
+ * first handle is closed. otcli_exec() may be called from any thread; calls
+ * on the same handle run one at a time.
+ */
+typedef struct otcli otcli;
+
+/* Receives the complete output of one command. data is not NUL terminated
+ * and is only valid during the call. */
+typedef void (*otcli_output)(const char* data, size_t length, void* context);
+
+/* Returns NULL when the client is already open or cannot be started. */
+OTCLI_API otcli* otcli_open(void);
+
+/* Runs one command. argv holds the command and its options exactly as they
+ * follow "opentxs" on the command line. Returns the exit code the opentxs
+ * executable would have returned. Log messages still go to stderr; output
+ * may be NULL to discard the command output. */
+OTCLI_API int otcli_exec(
+    otcli* handle,
+    int argc,
+    const char* const* argv,
+    otcli_output output,
+    void* context);
+
+OTCLI_API void otcli_close(otcli* handle);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __OPENTXS_OTCLI_H__ */
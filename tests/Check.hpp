@@ -0,0 +1,80 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#ifndef __OPENTXS_TESTS_CHECK_HPP__
+#define __OPENTXS_TESTS_CHECK_HPP__
+
+#include <iostream>
+
+// Minimal assertions for the test executables: a failed CHECK reports the
+// expression and carries on, main() returns the number of failures.
+namespace opentxs
+{
+namespace test
+{
+inline int& failures()
+{
+    static int count = 0;
+    return count;
+}
+}  // namespace test
+}  // namespace opentxs
+
+#define CHECK(condition)                                                     \
+    do {                                                                     \
+        if (!(condition)) {                                                  \
+            std::cerr << __FILE__ << ":" << __LINE__                         \
+                      << ": CHECK failed: " #condition "\n";                 \
+            opentxs::test::failures()++;                                     \
+        }                                                                    \
+    } while (false)
+
+#define CHECK_EQ(actual, expected)                                           \
+    do {                                                                     \
+        if (!((actual) == (expected))) {                                     \
+            std::cerr << __FILE__ << ":" << __LINE__                         \
+                      << ": CHECK_EQ failed: " #actual " == " #expected      \
+                      << "\n    actual:   " << (actual)                      \
+                      << "\n    expected: " << (expected) << "\n";           \
+            opentxs::test::failures()++;                                     \
+        }                                                                    \
+    } while (false)
+
+#define TEST_RESULT() (0 == opentxs::test::failures() ? 0 : 1)
+
+#endif  // __OPENTXS_TESTS_CHECK_HPP__
@@ -0,0 +1,147 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Check.hpp"
+
+#include "commands/CmdBase.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+atomic<int> inClient{0};
+atomic<int> mostInClient{0};
+
+mutex flightLock;
+condition_variable flightChanged;
+int inFlight = 0;
+int mostInFlight = 0;
+
+void enterClient()
+{
+    int now = ++inClient;
+    int seen = mostInClient;
+    while (seen < now && !mostInClient.compare_exchange_weak(seen, now)) {}
+}
+
+// Stands in for a ServerAction: it does not answer before the other
+// request is on the wire as well, or before giving up after a while.
+class Request
+{
+public:
+    string Run() const
+    {
+        unique_lock<mutex> lock(flightLock);
+        mostInFlight = max(mostInFlight, ++inFlight);
+        flightChanged.notify_all();
+        flightChanged.wait_for(
+            lock, chrono::seconds(10), []() { return 2 <= mostInFlight; });
+        inFlight--;
+        return "reply";
+    }
+};
+
+// A command that works with the wallet before and after its round trip,
+// like refresh or transfer do.
+class CmdSlow : public CmdBase
+{
+public:
+protected:
+    int32_t runWithOptions() override
+    {
+        wallet();
+        Request request;
+        string reply = notaryRun(&request);
+        wallet();
+        return "reply" == reply ? 1 : -1;
+    }
+
+private:
+    void wallet() const
+    {
+        enterClient();
+        this_thread::sleep_for(chrono::milliseconds(20));
+        inClient--;
+    }
+};
+
+// what Opentxs::startJob does for "slow &", through runCommand
+void job(bool& passed)
+{
+    CmdBase::NoInput noInput;
+    CmdSlow cmd;
+    CmdBase::Values values{};
+    CmdBase::ClientLock lock;
+    passed = cmd.run(values, "text");
+}
+}  // namespace
+
+// Two background jobs have their requests in flight at the same time,
+// while their wallet work still takes turns.
+int main()
+{
+    bool passed[2] = {false, false};
+    auto started = chrono::steady_clock::now();
+    thread first(job, ref(passed[0]));
+    thread second(job, ref(passed[1]));
+    first.join();
+    second.join();
+    auto elapsed = chrono::steady_clock::now() - started;
+
+    CHECK(passed[0]);
+    CHECK(passed[1]);
+    CHECK_EQ(mostInFlight, 2);
+    CHECK_EQ(mostInClient.load(), 1);
+    // neither request had to wait out the other one's timeout
+    CHECK(chrono::seconds(5) > elapsed);
+
+    // a nested ClientLock on the same thread must not deadlock
+    {
+        CmdBase::ClientLock outer;
+        CmdBase::ClientLock inner;
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,92 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Check.hpp"
+
+#include "CmdRegistry.hpp"
+
+#include <string.h>
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+// Every command finds its own entry in the registry table, which holds
+// its name, category and help text. Constructing a command needs no
+// client, so every entry can be checked here.
+int main()
+{
+    CHECK(0 < CmdRegistry::size());
+
+    CmdRegistry registry;
+    set<string> names;
+    for (size_t i = 0; i < CmdRegistry::size(); i++) {
+        const auto& entry = CmdRegistry::entry(i);
+        unique_ptr<CmdBase> cmd(entry.create());
+
+        // a command reads its name, category and help from its own entry
+        CHECK(&entry == CmdRegistry::entry(*cmd));
+        CHECK_EQ(string(cmd->getCommand()), entry.command);
+        CHECK_EQ(cmd->getCategory(), entry.category);
+        CHECK_EQ(string(cmd->getHelp()), entry.help);
+
+        CHECK(names.insert(entry.command).second);
+        CHECK_EQ(registry.find(entry.command), int32_t(i));
+    }
+
+    CHECK_EQ(registry.find("nosuchcommand"), -1);
+
+    // the resolver and the unit cache are reloaded after these
+    for (const char* command : {"addcontract",
+                                "checknym",
+                                "exportcash",
+                                "getcontract",
+                                "issueasset",
+                                "newaccount",
+                                "pairnode",
+                                "registernym",
+                                "renamenym"}) {
+        CHECK(0 <= registry.find(command));
+        CHECK(CmdRegistry::changesWallet(command));
+    }
+    CHECK(!CmdRegistry::changesWallet("showaccounts"));
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,110 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Check.hpp"
+
+#include "ScriptCompiler.hpp"
+
+#include <stdint.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+const uint64_t SOURCE = 42;
+
+// the file CompiledScript::save() writes for a single command line
+string saved(int32_t argc, const string& args)
+{
+    CompiledScript script;
+    if (0 <= argc) {
+        ScriptLine line;
+        line.kind = ScriptLine::Command;
+        line.lineNumber = 1;
+        line.text = line.expanded = "showaccounts";
+        line.argc = argc;
+        line.args = args;
+        script.add(line);
+    }
+
+    auto path = filesystem::temp_directory_path() / "opentxs-cli-test.bin";
+    CHECK(script.save(path.string(), SOURCE));
+    ifstream file(path.string().c_str(), ios::in | ios::binary);
+    string data{istreambuf_iterator<char>(file), istreambuf_iterator<char>()};
+    filesystem::remove(path);
+    return data;
+}
+}  // namespace
+
+// A compiled script comes from the cache or from the user, so load() has
+// to reject anything the runner would read past the end of.
+int main()
+{
+    const string args("opentxs\0showaccounts\0", 21);
+
+    CompiledScript script;
+    CHECK(script.load(saved(2, args), SOURCE));
+    CHECK_EQ(script.lines().size(), 1u);
+    CHECK(!script.load(saved(2, args), SOURCE + 1));
+
+    // argc has to match the arguments, all of them terminated
+    CHECK(!script.load(saved(3, args), SOURCE));
+    CHECK(!script.load(saved(1, args), SOURCE));
+    CHECK(!script.load(saved(2, args.substr(0, args.length() - 1)), SOURCE));
+    CHECK(!script.load(saved(0, ""), SOURCE));
+    CHECK(script.lines().empty());
+
+    // every truncation of a valid file is rejected
+    const string data = saved(2, args);
+    for (size_t length = 0; length < data.length(); length++) {
+        CHECK(!script.load(data.substr(0, length), SOURCE));
+    }
+
+    // a line count the file cannot back up
+    string empty = saved(-1, "");
+    CHECK(script.load(empty, SOURCE));
+    empty.replace(empty.length() - 4, 4, 4, '\xff');
+    CHECK(!script.load(empty, SOURCE));
+
+    return TEST_RESULT();
+}
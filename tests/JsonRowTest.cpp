@@ -0,0 +1,112 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+#include "Check.hpp"
+
+#include "JsonRow.hpp"
+
+#include <stdint.h>
+#include <sstream>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// a row with a single string field
+string quoted(const string& value)
+{
+    ostringstream out;
+    JsonRow(out).field("v", value);
+    return out.str();
+}
+}  // namespace
+
+int main()
+{
+    // a row without fields is still a complete line
+    {
+        ostringstream out;
+        { JsonRow row(out); }
+        CHECK_EQ(out.str(), "{}\n");
+    }
+
+    // empty values are written as empty strings, not left out
+    {
+        ostringstream out;
+        JsonRow(out).field("a", "").field("b", string());
+        CHECK_EQ(out.str(), "{\"a\":\"\",\"b\":\"\"}\n");
+    }
+
+    // escaping, including at the start and end of a value
+    CHECK_EQ(quoted("plain text"), "{\"v\":\"plain text\"}\n");
+    CHECK_EQ(quoted("\"quoted\""), "{\"v\":\"\\\"quoted\\\"\"}\n");
+    CHECK_EQ(quoted("back\\slash"), "{\"v\":\"back\\\\slash\"}\n");
+    CHECK_EQ(quoted("a\nb\rc\td"), "{\"v\":\"a\\nb\\rc\\td\"}\n");
+    CHECK_EQ(quoted("\x01\x1f"), "{\"v\":\"\\u0001\\u001f\"}\n");
+    CHECK_EQ(quoted(string("nul\0byte", 8)), "{\"v\":\"nul\\u0000byte\"}\n");
+    // UTF-8 passes through unchanged, as does DEL
+    CHECK_EQ(quoted("caf\xc3\xa9\x7f"), "{\"v\":\"caf\xc3\xa9\x7f\"}\n");
+
+    // numbers and booleans are written bare
+    {
+        ostringstream out;
+        JsonRow(out)
+            .field("i", int32_t(-42))
+            .field("min", INT64_MIN)
+            .field("max", INT64_MAX)
+            .field("zero", int64_t(0))
+            .field("yes", true)
+            .field("no", false);
+        CHECK_EQ(
+            out.str(),
+            "{\"i\":-42,\"min\":-9223372036854775808,"
+            "\"max\":9223372036854775807,\"zero\":0,"
+            "\"yes\":true,\"no\":false}\n");
+    }
+
+    // one line per row
+    {
+        ostringstream out;
+        JsonRow(out).field("n", int32_t(1));
+        JsonRow(out).field("n", int32_t(2));
+        CHECK_EQ(out.str(), "{\"n\":1}\n{\"n\":2}\n");
+    }
+
+    return TEST_RESULT();
+}
@@ -0,0 +1,145 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Check.hpp"
+
+#include "LineTokenizer.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// the arguments after argv[0]
+vector<string> split(LineTokenizer& tokenizer, const string& line)
+{
+    tokenizer.tokenize("opentxs", line);
+
+    vector<string> args;
+    for (int i = 1; i < tokenizer.argc(); i++) {
+        args.push_back(tokenizer.argv()[i]);
+    }
+    return args;
+}
+
+using Args = vector<string>;
+
+void whitespace()
+{
+    LineTokenizer tokenizer;
+    CHECK(Args{} == split(tokenizer, ""));
+    CHECK(Args{} == split(tokenizer, "  \t "));
+    CHECK(Args({"showaccounts"}) == split(tokenizer, "showaccounts"));
+    CHECK(Args({"a", "b", "c"}) == split(tokenizer, "  a   b\t c  "));
+
+    tokenizer.tokenize("opentxs", "inbox --myacct x");
+    CHECK_EQ(tokenizer.argc(), 4);
+    CHECK_EQ(string(tokenizer.argv()[0]), "opentxs");
+    CHECK_EQ(tokenizer.args()[3], "x");
+}
+
+void quotes()
+{
+    LineTokenizer tokenizer;
+    CHECK(Args({"a", "b c", "d"}) == split(tokenizer, "a \"b c\" d"));
+    // an unterminated quote ends at the end of the line
+    CHECK(Args({"a", "b c "}) == split(tokenizer, "a \"b c "));
+    CHECK(Args({""}) == split(tokenizer, "\"\""));
+    // a quote only counts at the start of an argument
+    CHECK(Args({"a\"b", "c\""}) == split(tokenizer, "a\"b c\""));
+    CHECK(Args({"ab", "c"}) == split(tokenizer, "\"ab\"c"));
+}
+
+// a backslash is an ordinary character, see LineTokenizer.hpp
+void backslashes()
+{
+    LineTokenizer tokenizer;
+    CHECK(Args({"\\$FTACCT"}) == split(tokenizer, "\\$FTACCT"));
+    CHECK(Args({"a\\x"}) == split(tokenizer, "a\\x"));
+    CHECK(Args({"a\\\\b"}) == split(tokenizer, "a\\\\b"));
+    CHECK(Args({"a\\"}) == split(tokenizer, "a\\"));
+    // it does not escape whitespace
+    CHECK(Args({"a\\", "b"}) == split(tokenizer, "a\\ b"));
+    // nor the closing quote
+    CHECK(Args({"a\\", "b\""}) == split(tokenizer, "\"a\\\" b\""));
+    CHECK(Args({"memo \\$x"}) == split(tokenizer, "\"memo \\$x\""));
+}
+
+void expectFailure()
+{
+    LineTokenizer tokenizer;
+    CHECK(Args({"editserver"}) == split(tokenizer, "!editserver"));
+    CHECK(tokenizer.expectFailure());
+    CHECK(Args({"editserver", "--label", "x"}) ==
+          split(tokenizer, "! editserver --label x"));
+    CHECK(tokenizer.expectFailure());
+    // only a leading '!' counts
+    CHECK(Args({"a!b", "!c"}) == split(tokenizer, "a!b !c"));
+    CHECK(!tokenizer.expectFailure());
+    CHECK(Args({"!a"}) == split(tokenizer, " !a"));
+    CHECK(!tokenizer.expectFailure());
+    CHECK(Args{} == split(tokenizer, "!"));
+    CHECK(tokenizer.expectFailure());
+    CHECK(Args{} == split(tokenizer, ""));
+    CHECK(!tokenizer.expectFailure());
+}
+
+// the buffer is reused, a short line after a long one must not see any of
+// the long one
+void reuse()
+{
+    LineTokenizer tokenizer;
+    split(tokenizer, "showpurse --server aaaaaaaaaaaa --mynym bbbbbbbbbbbb");
+    CHECK(Args({"x", "y"}) == split(tokenizer, "x y"));
+    CHECK_EQ(
+        tokenizer.data(), string("opentxs\0x\0y\0", 12));
+}
+}  // namespace
+
+int main()
+{
+    whitespace();
+    quotes();
+    backslashes();
+    expectFailure();
+    reuse();
+    return TEST_RESULT();
+}
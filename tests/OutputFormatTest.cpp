@@ -0,0 +1,132 @@
+/************************************************************
+ *
+ *                 OPEN TRANSACTIONS
+ *
+ *       Financial Cryptography and Digital Cash
+ *       Library, Protocol, API, Server, CLI, GUI
+ *
+ *       -- Anonymous Numbered Accounts.
+ *       -- Untraceable Digital Cash.
+ *       -- Triple-Signed Receipts.
+ *       -- Cheques, Vouchers, Transfers, Inboxes.
+ *       -- Basket Currencies, Markets, Payment Plans.
+ *       -- Signed, XML, Ricardian-style Contracts.
+ *       -- Scripted smart contracts.
+ *
+ *  EMAIL:
+ *  fellowtraveler@opentransactions.org
+ *
+ *  WEBSITE:
+ *  http://www.opentransactions.org/
+ *
+ *  -----------------------------------------------------
+ *
+ *   LICENSE:
+ *   This Source Code Form is subject to the terms of the
+ *   Mozilla Public License, v. 2.0. If a copy of the MPL
+ *   was not distributed with this file, You can obtain one
+ *   at http://mozilla.org/MPL/2.0/.
+ *
+ *   DISCLAIMER:
+ *   This program is distributed in the hope that it will
+ *   be useful, but WITHOUT ANY WARRANTY; without even the
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *   PARTICULAR PURPOSE.  See the Mozilla Public License
+ *   for more details.
+ *
+ ************************************************************/
+
+#include "Check.hpp"
+
+#include "CmdRegistry.hpp"
+#include "OutputCapture.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+
+using namespace opentxs;
+using namespace std;
+
+namespace
+{
+// the commands that write --format=ndjson rows, see README.md
+const set<string> listings = {"inbox",
+                              "inpayments",
+                              "outbox",
+#ifndef _WIN32
+                              "queryrecords",
+#endif
+                              "showaccounts",
+                              "showexpired",
+                              "showmarkets",
+                              "showoffers",
+                              "showrecords",
+                              "showthread"};
+
+// prefixed with the command, so that a failure names it
+string show(const string& command, const char* format)
+{
+    return command + ": " + (nullptr == format ? "rejected" : format);
+}
+}  // namespace
+
+// Every command either writes ndjson rows or rejects --format=ndjson;
+// none may quietly print its text table instead.
+int main()
+{
+    size_t rows = 0;
+    for (size_t i = 0; i < CmdRegistry::size(); i++) {
+        unique_ptr<CmdBase> cmd(CmdRegistry::entry(i).create());
+        const string name = cmd->getCommand();
+        const bool listing = 0 < listings.count(name);
+        const string ndjson = listing ? "ndjson" : "rejected";
+        // a defaultformat of ndjson leaves the other commands on text
+        const string fallback = listing ? "ndjson" : "text";
+        if (listing) { rows++; }
+
+        CHECK_EQ(
+            show(name, cmd->outputFormat("ndjson", nullptr)),
+            name + ": " + ndjson);
+        CHECK_EQ(
+            show(name, cmd->outputFormat("ndjson", "text")),
+            name + ": " + ndjson);
+        CHECK_EQ(
+            show(name, cmd->outputFormat(nullptr, "ndjson")),
+            name + ": " + fallback);
+        CHECK_EQ(
+            show(name, cmd->outputFormat("text", "ndjson")), name + ": text");
+        CHECK_EQ(
+            show(name, cmd->outputFormat(nullptr, nullptr)), name + ": text");
+        CHECK_EQ(
+            show(name, cmd->outputFormat("xml", nullptr)),
+            name + ": rejected");
+        CHECK_EQ(
+            show(name, cmd->outputFormat(nullptr, "xml")),
+            name + ": rejected");
+    }
+
+    // every listing above is a registered command
+    CHECK_EQ(rows, listings.size());
+
+    // a refusal tells the user which command refused, and writes no output
+    {
+        CmdRegistry registry;
+        const int32_t index = registry.find("showwallet");
+        CHECK(0 <= index);
+        unique_ptr<CmdBase> cmd(CmdRegistry::entry(index).create());
+        string output, log;
+        const char* format = "";
+        {
+            OutputCapture capture(output, &log);
+            format = cmd->outputFormat("ndjson", nullptr);
+        }
+        CHECK(nullptr == format);
+        CHECK_EQ(
+            log,
+            string("Error: showwallet does not support --format=ndjson.\n"));
+        CHECK_EQ(output, string());
+    }
+
+    return TEST_RESULT();
+}